@@ -0,0 +1,92 @@
+/***************************************************************************************************/
+/* 
+   Example for 14-bit MAX31855 K-Thermocouple to Digital Converter with Cold Junction Compensation,
+   ATtiny USI (Universal Serial Interface) version, USI shifts bits in hardware
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+     Optimal performance of cold junction compensation happends when the thermocouple cold junction
+     & the MAX31855 are at the same temperature. Avoid placing heat-generating devices or components
+     near the converter because this may produce an errors.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+
+   This sensor uses USI to communicate, specials pins are required to interface
+   Board:                                     DI/SO       DO/x        USCK/SCK     CS          Level
+   ATtiny84, ATtiny44, ATtiny24.............  PA6         PA5         PA4          PA3         3v/5v
+   ATtiny2313, ATtiny4313...................  PB5         PB6         PB7          PB3         3v/5v
+   ATtiny85, ATtiny45, ATtiny25.............  PB0*        PB1         PB2          PB3         3v/5v
+
+                                              *ATtiny85 Serial TX is on PB0 by default, the same
+                                               pin as USI DI, print results on other mcu or move
+                                               Serial TX, see ATtiny Core docs
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#include <MAX31855usi.h>
+
+int32_t rawData     = 0;
+int16_t temperature = 0;
+
+/*
+  MAX31855usi(cs)
+
+  cs - chip select, SO & SCK are fixed USI DI & USCK pins, see table above
+*/
+
+#if defined(__AVR_ATtiny24__) || defined(__AVR_ATtiny44__) || defined(__AVR_ATtiny84__)
+MAX31855usi myMAX31855(PIN_PA3);
+#else
+MAX31855usi myMAX31855(PIN_PB3);
+#endif
+
+
+void setup()
+{
+  Serial.begin(9600);
+
+  /* start MAX31855 */
+  myMAX31855.begin();
+
+  while (myMAX31855.getChipID() != MAX31855_ID)
+  {
+    Serial.println(F("MAX31855 error")); //(F()) saves string to flash & keeps dynamic memory free
+    delay(5000);
+  }
+  Serial.println(F("MAX31855 OK"));
+}
+
+void loop()
+{
+  rawData = myMAX31855.readRawData();
+
+  if (myMAX31855.detectThermocouple(rawData) != MAX31855_THERMOCOUPLE_OK)
+  {
+    Serial.println(F("Thermocouple error"));
+    delay(5000);
+    return;
+  }
+
+  temperature = myMAX31855.getTemperatureCode(rawData);     //in 0.25°C
+
+  Serial.print(F("Thermocouple, 1/100C: "));
+  Serial.println((int32_t)temperature * 25);                //0.25°C is 25/100°C, no floating point
+
+  temperature = myMAX31855.getColdJunctionCode(rawData);    //in 0.0625°C
+
+  Serial.print(F("Cold Junction, 1/16C: "));
+  Serial.println(temperature);
+
+  delay(5000);
+}
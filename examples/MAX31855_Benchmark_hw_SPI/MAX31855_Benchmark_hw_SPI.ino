@@ -0,0 +1,228 @@
+/***************************************************************************************************/
+/* 
+   Example for 14-bit MAX31855 K-Thermocouple to Digital Converter with Cold Junction Compensation,
+   acquisition scaling benchmark: sequential, batched & non-blocking reads of many sensors,
+   reports samples/sec, per sensor jitter percentiles, time per sample & memory per channel
+
+   - blocking reads keep cpu busy while waiting, so wall time per sample is reported
+   - non-blocking update() reports cpu time spent inside update() per sample
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+     Optimal performance of cold junction compensation happends when the thermocouple cold junction
+     & the MAX31855 are at the same temperature. Avoid placing heat-generating devices or components
+     near the converter because this may produce an errors.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4
+                                              & GPIO0/D3 for flash & boot, use with caution!!!
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+#include <MAX31855.h>
+
+#define SENSORS        8     //qnt. of sensors, chip select pins FIRST_CS_PIN..FIRST_CS_PIN + SENSORS - 1
+#define FIRST_CS_PIN   2     //unconnected CS pins work as virtual sensors, frames are empty but bus time is the same
+#define SAMPLE_PERIOD  100   //in milliseconds, for non-blocking test
+#define TEST_TIME      10000 //in milliseconds, per test
+#define JITTER_BUCKETS 10    //qnt. of jitter histogram buckets, samples above the last bound are counted separately
+
+const uint16_t jitterBound[JITTER_BUCKETS] = {10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000}; //upper bounds in microseconds
+
+MAX31855 *mySensors[SENSORS];
+int32_t   rawData[SENSORS];
+uint32_t  lastStart[SENSORS];                                 //previous conversion start of each sensor, 0 - none
+uint16_t  jitterCount[SENSORS][JITTER_BUCKETS + 1];           //histogram per sensor, TEST_TIME / SAMPLE_PERIOD samples fit uint16_t
+
+
+void printResult(const __FlashStringHelper *name, uint32_t samples, uint32_t testTime, uint32_t usecTime, const __FlashStringHelper *unit)
+{
+  Serial.print(name);
+  Serial.print(F(": "));
+  Serial.print(samples * 1000UL / testTime);
+  Serial.print(F(" samples/sec, "));
+  Serial.print(usecTime / samples);
+  Serial.println(unit);
+}
+
+void countJitter(uint8_t sensor)
+{
+  uint32_t period;
+  uint32_t jitter;
+  uint8_t  bucket = 0;
+
+  if (lastStart[sensor] != 0)
+  {
+    period = mySensors[sensor]->getSampleMicros() - lastStart[sensor];
+    jitter = (period > (SAMPLE_PERIOD * 1000UL)) ? (period - SAMPLE_PERIOD * 1000UL) : (SAMPLE_PERIOD * 1000UL - period);
+
+    while (bucket < JITTER_BUCKETS && jitter > jitterBound[bucket]) bucket++;
+
+    jitterCount[sensor][bucket]++;
+  }
+
+  lastStart[sensor] = mySensors[sensor]->getSampleMicros();
+}
+
+void printPercentile(uint8_t sensor, uint8_t percent)
+{
+  uint32_t total = 0;
+  uint32_t count = 0;
+  uint8_t  bucket;
+
+  for (bucket = 0; bucket <= JITTER_BUCKETS; bucket++) total += jitterCount[sensor][bucket];
+
+  if (total == 0)
+  {
+    Serial.print('-');
+    return;
+  }
+
+  for (bucket = 0; bucket < JITTER_BUCKETS; bucket++)
+  {
+    count += jitterCount[sensor][bucket];
+
+    if ((count * 100) >= (total * percent)) break;
+  }
+
+  if (bucket < JITTER_BUCKETS)
+  {
+    Serial.print(F("<="));
+    Serial.print(jitterBound[bucket]);
+  }
+  else
+  {
+    Serial.print('>');
+    Serial.print(jitterBound[JITTER_BUCKETS - 1]);
+  }
+}
+
+void setup()
+{
+  Serial.begin(115200);
+
+  for (uint8_t i = 0; i < SENSORS; i++) mySensors[i] = new MAX31855(FIRST_CS_PIN + i);
+
+  MAX31855::beginAll(mySensors, SENSORS);
+
+  Serial.print(F("Sensors: "));
+  Serial.println(SENSORS);
+  Serial.print(F("RAM per channel, bytes: "));
+  Serial.println(sizeof(MAX31855));
+}
+
+void loop()
+{
+  uint32_t startTime;
+  uint32_t cpuTime;
+  uint32_t callTime;
+  uint32_t samples;
+
+  /* sequential, each read waits for own conversion */
+  samples   = 0;
+  startTime = millis();
+
+  while ((millis() - startTime) < TEST_TIME)
+  {
+    for (uint8_t i = 0; i < SENSORS; i++) rawData[i] = mySensors[i]->readRawData();
+
+    samples += SENSORS;
+  }
+
+  printResult(F("readRawData()   "), samples, millis() - startTime, (millis() - startTime) * 1000, F(" usec wall/sample")); //cpu is busy waiting all the time
+
+  /* batched, all conversions in parallel & one sweep */
+  samples   = 0;
+  startTime = millis();
+
+  while ((millis() - startTime) < TEST_TIME)
+  {
+    MAX31855::readRawDataAll(mySensors, rawData, SENSORS);
+
+    samples += SENSORS;
+  }
+
+  printResult(F("readRawDataAll()"), samples, millis() - startTime, (millis() - startTime) * 1000, F(" usec wall/sample"));
+
+  /* non-blocking, aligned timeline, cpu time is counted only inside update() */
+  samples   = 0;
+  cpuTime   = 0;
+  startTime = millis();
+
+  memset(jitterCount, 0, sizeof(jitterCount));
+
+  for (uint8_t i = 0; i < SENSORS; i++)
+  {
+    mySensors[i]->setSamplePeriod(SAMPLE_PERIOD, startTime);  //clears jitter statistics
+    lastStart[i] = 0;
+  }
+
+  while ((millis() - startTime) < TEST_TIME)
+  {
+    for (uint8_t i = 0; i < SENSORS; i++)
+    {
+      callTime = micros();
+
+      if (mySensors[i]->update() == true)
+      {
+        cpuTime += micros() - callTime;                        //jitter bookkeeping is not counted
+
+        samples++;
+        countJitter(i);
+      }
+      else
+      {
+        cpuTime += micros() - callTime;
+      }
+    }
+  }
+
+  printResult(F("update()        "), samples, millis() - startTime, cpuTime, F(" usec cpu/sample"));
+
+  for (uint8_t i = 0; i < SENSORS; i++)
+  {
+    Serial.print(F("  sensor "));
+    Serial.print(i);
+    Serial.print(F(" jitter p50/p95/p99, usec: "));
+    printPercentile(i, 50);
+    Serial.print('/');
+    printPercentile(i, 95);
+    Serial.print('/');
+    printPercentile(i, 99);
+    Serial.print(F(", max/mean: "));
+    Serial.print(mySensors[i]->getJitterMax());
+    Serial.print('/');
+    Serial.print(mySensors[i]->getJitterMean());
+    Serial.print(F(", skipped: "));
+    Serial.println(mySensors[i]->getSkippedSamples());
+
+    mySensors[i]->setSamplePeriod(0);                          //back to free running
+  }
+
+  Serial.println();
+}
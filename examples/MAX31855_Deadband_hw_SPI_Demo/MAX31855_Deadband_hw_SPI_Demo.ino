@@ -0,0 +1,92 @@
+/***************************************************************************************************/
+/* 
+   Example for 14-bit MAX31855 K-Thermocouple to Digital Converter with Cold Junction Compensation,
+   prints temperature only if it has changed more than deadband
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+     Optimal performance of cold junction compensation happends when the thermocouple cold junction
+     & the MAX31855 are at the same temperature. Avoid placing heat-generating devices or components
+     near the converter because this may produce an errors.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4
+                                              & GPIO0/D3 for flash & boot, use with caution!!!
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#include <MAX31855.h>
+#include <MAX31855deadband.h>
+
+#define DEADBAND  0.5   //in °C, smaller changes are not printed
+#define HEARTBEAT 60000 //in milliseconds, print at least once per minute
+
+/*
+  MAX31855(cs)
+
+  cs - chip select
+*/
+
+MAX31855         myMAX31855(3); //chip select pin, for ESP8266 change to D4 (fails to BOOT/FLASH if pin LOW)
+MAX31855deadband myDeadband(1); //channel number passed to callback
+
+
+void printSample(uint8_t channel, int16_t code, uint8_t status)
+{
+  Serial.print(F("Thermocouple_"));
+  Serial.print(channel);
+  Serial.print(F(": "));
+
+  if (status == MAX31855_THERMOCOUPLE_OK) Serial.println((float)code * MAX31855_THERMOCOUPLE_RESOLUTION);
+  else                                    Serial.println(F("error"));
+}
+
+void setup()
+{
+  Serial.begin(115200);
+
+  /* start MAX31855 */
+  myMAX31855.begin();
+
+  while (myMAX31855.getChipID() != MAX31855_ID)
+  {
+    Serial.println(F("MAX31855 error")); //(F()) saves string to flash & keeps dynamic memory free
+    delay(5000);
+  }
+  Serial.println(F("MAX31855 OK"));
+
+  myDeadband.begin(DEADBAND, HEARTBEAT, printSample);
+}
+
+void loop()
+{
+  int32_t rawData = myMAX31855.readRawData(); //~10Hz sampling, but only changes are printed
+
+  myDeadband.update(myMAX31855.getTemperatureCode(rawData), myMAX31855.detectThermocouple(rawData));
+}
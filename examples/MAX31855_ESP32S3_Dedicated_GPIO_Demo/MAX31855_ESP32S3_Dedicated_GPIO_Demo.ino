@@ -0,0 +1,82 @@
+/***************************************************************************************************/
+/* 
+   Example for 14-bit MAX31855 K-Thermocouple to Digital Converter with Cold Junction Compensation
+   on ESP32-S2/S3/C3 dedicated GPIO, four sensors share one CS & SCK & have own SO lines
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+
+   - all four sensors convert at the same time & one 32-clock sweep reads all of them
+
+   Board:                                     Level
+   ESP32-S2, ESP32-S3, ESP32-C3.............  3v
+
+                                              *any GPIO can be used, avoid strapping pins
+
+   Frameworks & Libraries:
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#include <MAX31855dedic.h>
+
+#define SENSORS 4
+
+const uint8_t soPins[SENSORS] = {4, 5, 6, 7};
+
+int32_t rawData[SENSORS];
+
+/*
+  MAX31855dedic(cs, so, sck)
+  MAX31855dedic(cs, sck, so[], quantity)
+
+  cs       - chip select
+  so       - serial data output
+  sck      - serial clock input
+  quantity - qnt. of sensors sharing cs & sck
+*/
+
+MAX31855dedic myMAX31855(10, 12, soPins, SENSORS);
+
+
+void setup()
+{
+  Serial.begin(115200);
+
+  /* start MAX31855 */
+  myMAX31855.begin();
+
+  while (myMAX31855.getChipID() != MAX31855_ID)
+  {
+    Serial.println(F("MAX31855_01 error")); //the first sensor is checked, no free dedicated GPIO channels is read fail too
+    delay(5000);
+  }
+  Serial.println(F("MAX31855_01 OK"));
+}
+
+void loop()
+{
+  myMAX31855.readRawDataParallel(rawData);
+
+  for (uint8_t i = 0; i < SENSORS; i++)
+  {
+    Serial.print(F("Thermocouple_0"));
+    Serial.print(i + 1);
+    Serial.print(F(": "));
+
+    if   (myMAX31855.detectThermocouple(rawData[i]) == MAX31855_THERMOCOUPLE_OK) Serial.println(myMAX31855.getTemperature(rawData[i]));
+    else                                                                          Serial.println(F("error"));
+  }
+
+  delay(5000);
+}
@@ -0,0 +1,82 @@
+/***************************************************************************************************/
+/* 
+   Example for 14-bit MAX31855 K-Thermocouple to Digital Converter with Cold Junction Compensation
+   on ESP32 SPI controller in quad mode, four sensors share one CS & SCK, SO lines go to D0..D3
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+
+   - all four sensors convert at the same time & one 32-clock quad transaction reads all of them
+   - HSPI is used, default Arduino SPI instance stays on VSPI
+
+   Board:                                    CS          SCK         D0..D3                     Level
+   ESP32, HSPI.............................. GPIO15      GPIO14      GPIO13, GPIO12, GPIO2, GPIO4  3v
+
+                                             *GPIO12 & GPIO2 are strapping pins, SO is high-Z while CS
+                                              is high, so boot is not affected, for ESP32-S2/S3/C3 use
+                                              SPI2_HOST & any free GPIO
+
+   Frameworks & Libraries:
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#include <MAX31855quad.h>
+
+#define SENSORS MAX31855_QUAD_LINES
+
+int32_t rawData[SENSORS];
+
+/*
+  MAX31855quad(cs, sck, d0, d1, d2, d3, host)
+
+  cs     - chip select
+  sck    - serial clock input
+  d0..d3 - serial data outputs of sensor 1..4
+  host   - SPI controller
+*/
+
+MAX31855quad myMAX31855(15, 14, 13, 12, 2, 4, HSPI_HOST);
+
+
+void setup()
+{
+  Serial.begin(115200);
+
+  /* start MAX31855 */
+  myMAX31855.begin();
+
+  while (myMAX31855.getChipID() != MAX31855_ID)
+  {
+    Serial.println(F("MAX31855_01 error")); //the first sensor is checked, SPI controller init error is read fail too
+    delay(5000);
+  }
+  Serial.println(F("MAX31855_01 OK"));
+}
+
+void loop()
+{
+  myMAX31855.readRawDataQuad(rawData);
+
+  for (uint8_t i = 0; i < SENSORS; i++)
+  {
+    Serial.print(F("Thermocouple_0"));
+    Serial.print(i + 1);
+    Serial.print(F(": "));
+
+    if   (myMAX31855.detectThermocouple(rawData[i]) == MAX31855_THERMOCOUPLE_OK) Serial.println(myMAX31855.getTemperature(rawData[i]));
+    else                                                                          Serial.println(F("error"));
+  }
+
+  delay(5000);
+}
@@ -0,0 +1,131 @@
+/***************************************************************************************************/
+/* 
+   Example for 14-bit MAX31855 K-Thermocouple to Digital Converter with Cold Junction Compensation
+   on both ESP32 hardware SPI buses, each bus is read by own FreeRTOS task
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+
+   - sensors on one bus are converted in parallel & read in one sweep by MAX31855::readRawDataAll(),
+     the two buses are clocked by independent controllers, so total scan time is the time of
+     the slowest bus & not the sum of both
+   - each task publishes frames to own MAX31855ring, ring has one writer & any number of readers
+   - SPIClass instance must outlive the sensors, declare it before them
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   ESP32, VSPI (default SPI)................ GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+   ESP32, HSPI.............................. GPIO13/D13  GPIO12/D12  GPIO14/D14   x                      3v
+
+                                             *GPIO12 is bootstrap pin, thermocouple board must not
+                                              pull it high during reset, use with caution!!!
+
+   Frameworks & Libraries:
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#include <MAX31855.h>
+#include <MAX31855ring.h>
+
+#define SENSORS_PER_BUS 2
+#define SAMPLE_PERIOD   250                  //in milliseconds
+
+SPIClass hSPI(HSPI);                         //second hw SPI bus, VSPI is used by default SPI instance
+
+/*
+  MAX31855(cs)
+  MAX31855(cs, spi)
+
+  cs  - chip select
+  spi - hw SPI bus, default SPI if omitted
+*/
+
+MAX31855 myMAX31855_01(5);                   //VSPI
+MAX31855 myMAX31855_02(17);                  //VSPI
+MAX31855 myMAX31855_03(15, hSPI);            //HSPI
+MAX31855 myMAX31855_04(16, hSPI);            //HSPI
+
+MAX31855 *vspiSensors[SENSORS_PER_BUS] = {&myMAX31855_01, &myMAX31855_02};
+MAX31855 *hspiSensors[SENSORS_PER_BUS] = {&myMAX31855_03, &myMAX31855_04};
+
+MAX31855ring vspiRing;
+MAX31855ring hspiRing;
+
+typedef struct
+{
+  MAX31855     **sensor;
+  MAX31855ring *ring;
+  uint8_t      firstChannel;
+} Bus;
+
+Bus vspiBus = {vspiSensors, &vspiRing, 0};
+Bus hspiBus = {hspiSensors, &hspiRing, SENSORS_PER_BUS};
+
+
+/* one task per bus, tasks don't share any SPI state */
+void busTask(void *parameter)
+{
+  Bus       *bus = (Bus *)parameter;
+  int32_t    rawData[SENSORS_PER_BUS];
+  TickType_t lastWake = xTaskGetTickCount();
+
+  MAX31855::beginAll(bus->sensor, SENSORS_PER_BUS); //calls begin() of sensor's SPI bus, HSPI default pins SCK=14, MISO=12, MOSI=13
+
+  for (;;)
+  {
+    MAX31855::readRawDataAll(bus->sensor, rawData, SENSORS_PER_BUS);
+
+    for (uint8_t i = 0; i < SENSORS_PER_BUS; i++)
+    {
+      bus->ring->publish(bus->firstChannel + i, rawData[i], bus->sensor[i]->getSampleTime());
+    }
+
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(SAMPLE_PERIOD));
+  }
+}
+
+void printSample(MAX31855 &sensor, const MAX31855_Sample &sample)
+{
+  Serial.print(F("Thermocouple_0"));
+  Serial.print(sample.channel + 1);
+  Serial.print(F(": "));
+
+  if   (sensor.detectThermocouple(sample.rawData) == MAX31855_THERMOCOUPLE_OK) Serial.print(sensor.getTemperature(sample.rawData));
+  else                                                                           Serial.print(F("error"));
+
+  Serial.print(F(", at "));
+  Serial.print(sample.time);
+  Serial.println(F("ms"));
+}
+
+void setup()
+{
+  Serial.begin(115200);
+
+  xTaskCreatePinnedToCore(busTask, "vspi", 4096, &vspiBus, 1, NULL, 0);
+  xTaskCreatePinnedToCore(busTask, "hspi", 4096, &hspiBus, 1, NULL, 1);
+}
+
+void loop()
+{
+  MAX31855_Sample sample;
+
+  for (uint8_t i = 0; i < SENSORS_PER_BUS; i++)
+  {
+    if (vspiRing.getLatest(i, sample) == true)                   printSample(*vspiSensors[i], sample);
+    if (hspiRing.getLatest(SENSORS_PER_BUS + i, sample) == true) printSample(*hspiSensors[i], sample);
+  }
+
+  delay(1000);
+}
@@ -0,0 +1,124 @@
+/***************************************************************************************************/
+/* 
+   Example for 14-bit MAX31855 K-Thermocouple to Digital Converter with Cold Junction Compensation,
+   serves OpenMetrics over HTTP for Prometheus scraping
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+     Optimal performance of cold junction compensation happends when the thermocouple cold junction
+     & the MAX31855 are at the same temperature. Avoid placing heat-generating devices or components
+     near the converter because this may produce an errors.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+
+   This sensor uses SPI bus to communicate, specials pins are required to interface
+   Board:                                    MOSI        MISO        SCLK         SS, don't use for CS   Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... 11          12          13           10                     5v
+   Mega, Mega2560, ATmega1280, ATmega2560... 51          50          52           53                     5v
+   Due, SAM3X8E............................. ICSP4       ICSP1       ICSP3        x                      3.3v
+   Leonardo, ProMicro, ATmega32U4........... 16          14          15           x                      5v
+   Blue Pill, STM32F103xxxx boards.......... PA17        PA6         PA5          PA4                    3v
+   NodeMCU 1.0, WeMos D1 Mini............... GPIO13/D7   GPIO12/D6   GPIO14/D5    GPIO15/D8*             3v/5v
+   ESP32.................................... GPIO23/D23  GPIO19/D19  GPIO18/D18   x                      3v
+
+                                             *most boards has 10-12kOhm pullup-up resistor on GPIO2/D4
+                                              & GPIO0/D3 for flash & boot, use with caution!!!
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+   ESP8266 Core          - https://github.com/esp8266/Arduino
+   STM32   Core          - https://github.com/stm32duino/Arduino_Core_STM32
+                         - https://github.com/rogerclarkmelbourne/Arduino_STM32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#include <SPI.h>
+#include <ESP8266WiFi.h>
+#include <MAX31855.h>
+#include <MAX31855metrics.h>
+
+#define WIFI_SSID     "your-ssid"
+#define WIFI_PASSWORD "your-password"
+
+/*
+  MAX31855(cs)
+
+  cs - chip select
+*/
+
+MAX31855        myMAX31855(D4); //chip select pin, ESP8266 fails to BOOT/FLASH if D4 is LOW
+MAX31855metrics myMetrics;
+WiFiServer      myServer(80);   //scrape http://<ip>/metrics
+
+#define REQUEST_TIMEOUT 500     //max wait for request headers, in milliseconds
+
+
+void setup()
+{
+  WiFi.persistent(false);       //disable saving wifi config into SDK flash area
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+
+  Serial.begin(115200);
+
+  while (WiFi.status() != WL_CONNECTED)
+  {
+    Serial.print(F("."));
+    delay(500);
+  }
+  Serial.println(WiFi.localIP());
+
+  /* start MAX31855 */
+  myMAX31855.begin();
+  myMAX31855.setSamplePeriod(1000); //1Hz
+
+  myServer.begin();
+}
+
+void loop()
+{
+  WiFiClient client;
+  uint32_t   timer;
+  uint8_t    newLines = 0;
+  int        symbol;
+
+  if (myMAX31855.update() == true) myMetrics.update(0, myMAX31855, myMAX31855.getRawData()); //non-blocking
+
+  client = myServer.available();
+
+  if (!client) return;
+
+  /* drain request line & headers byte by byte up to empty line, no String & no heap, any path returns metrics */
+  timer = millis();
+
+  while (client.connected() && (millis() - timer) < REQUEST_TIMEOUT)
+  {
+    symbol = client.read();                                   //-1 if nothing is received yet
+
+    if (symbol == -1)
+    {
+      yield();
+      continue;
+    }
+
+    if (symbol == '\n' && ++newLines == 2) break;             //"\r\n\r\n" ends headers
+    if (symbol != '\n' && symbol != '\r') newLines = 0;
+  }
+
+  client.print(F("HTTP/1.0 200 OK\r\n"
+                 "Content-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\n"
+                 "Connection: close\r\n\r\n"));
+
+  myMetrics.print(client);                                    //rendered directly to socket, no heap
+
+  client.stop();
+}
@@ -57,18 +57,19 @@
 #include <ESP8266WiFi.h>
 #include <MAX31855.h>
 #include <LiquidCrystal_I2C.h>  //https://github.com/enjoyneering/LiquidCrystal_I2C
+#include <MAX31855lcd.h>
 
 #define LCD_ROWS           4    //qnt. of lcd rows
 #define LCD_COLUMNS        20   //qnt. of lcd columns
 
 #define LCD_DEGREE_SYMBOL  0xDF //degree symbol from lcd ROM, see p.9 of GDM2004D datasheet
-#define LCD_SPACE_SYMBOL   0x20 //space  symbol from lcd ROM, see p.9 of GDM2004D datasheet
 
 #define MAX_TEMPERATURE    45   //max temp, in °C
 
 const uint8_t iconTemperature[8] PROGMEM = {0x04, 0x0E, 0x0E, 0x0E, 0x0E, 0x1F, 0x1F, 0x0E}; //PROGMEM saves variable to flash & keeps dynamic memory free
 
-float temperature = 0;
+int32_t rawData = 0;
+int16_t code    = 0;
 
 /*
 MAX31855(cs)
@@ -79,6 +80,8 @@ cs - chip select
 MAX31855          myMAX31855(D4); //chip select pin, ESP8266 fails to BOOT/FLASH if D4 is LOW
 LiquidCrystal_I2C lcd(PCF8574_ADDR_A21_A11_A01, 4, 5, 6, 16, 11, 12, 13, 14, POSITIVE);
 
+MAX31855lcd<LiquidCrystal_I2C, LCD_COLUMNS, LCD_ROWS> display(lcd); //sends only changed chars
+
 
 void setup()
 {
@@ -149,37 +152,41 @@ void setup()
   /* load custom symbol to CGRAM */
   lcd.createChar(0, iconTemperature);
 
-  /* prints static text */
-  lcd.setCursor(0, 0);
-  lcd.write(0);                                                   //print temperature icon
-  lcd.setCursor(0, 1);
-  lcd.write(0);
-  
+  /* draws static text, it is sent once */
+  display.write(0, 0, 0);                                         //temperature icon
+  display.write(8, 0, LCD_DEGREE_SYMBOL);
+  display.write(9, 0, 'C');
+
+  display.write(0, 1, 0);
+  display.write(8, 1, LCD_DEGREE_SYMBOL);
+  display.write(9, 1, 'C');
+
+  display.write(0, 2, 'T');                                       //name of the bar
+  display.write(0, 3, 'T');
+
+  display.invalidate();                                           //lcd was cleared directly
+  display.refresh();
 }
 
 void loop()
 {
-  temperature = myMAX31855.getTemperature();
+  rawData = myMAX31855.readRawData();
+
+  code = myMAX31855.getTemperatureCode(rawData);                  //in 0.25°C, "error" if thermocouple short to Vcc, or to GND, or not connected
+
+  display.printTemperature(2, 0, code, 6, 1);                     //column, row, code, width, decimals
+  if (code == MAX31855_ERROR_CODE) code = 0;                      //empty bar
 
-  lcd.setCursor(2, 0);
-  if (temperature != MAX31855_ERROR) lcd.print(temperature, 1);
-  else                               lcd.print(F("xx"));          //thermocouple short to Vcc, or to GND, or not connected
-  lcd.write(LCD_DEGREE_SYMBOL);
-  lcd.print(F("C"));
-  lcd.write(LCD_SPACE_SYMBOL);
+  display.printBar(1, 2, LCD_COLUMNS - 1, code, MAX_TEMPERATURE * 4); //column, 3-rd row, width, current value, max. value
 
-  lcd.printHorizontalGraph('T', 2, temperature, MAX_TEMPERATURE); //name of the bar, 3-rd row, current value, max. value
+  code = myMAX31855.getColdJunctionCode(rawData);                 //in 0.0625°C, "error" on spi bus or not MAX31855 sensor
 
-  temperature = myMAX31855.getColdJunctionTemperature();
+  display.printColdJunction(2, 1, code, 6, 1);
+  if (code == MAX31855_ERROR_CODE) code = 0;
 
-  lcd.setCursor(2, 1);
-  if (temperature != MAX31855_ERROR) lcd.print(temperature, 1);
-  else                               lcd.print(F("xx"));          //error on spi bus or not MAX31855 sensor
-  lcd.write(LCD_DEGREE_SYMBOL);
-  lcd.print(F("C"));
-  lcd.write(LCD_SPACE_SYMBOL);
+  display.printBar(1, 3, LCD_COLUMNS - 1, code, 30 * 16);         //column, 4-rd row, width, current value, max. value
 
-  lcd.printHorizontalGraph('T', 3, temperature, 30);              //name of the bar, 4-rd row, current value, max. value
+  display.refresh();                                              //nothing is sent if temperature is not changed
 
   delay(1000);
 }
@@ -42,8 +42,7 @@
 /***************************************************************************************************/
 #include <MAX31855.h>
 
-int32_t rawData_01  = 0;
-int32_t rawData_02  = 0;
+int32_t rawData[2] = {0, 0};
 
 /*
   MAX31855(cs)
@@ -54,13 +53,14 @@ int32_t rawData_02  = 0;
 MAX31855 myMAX31855_01(3); //for ESP8266 change to D3 (fails to BOOT/FLASH if pin LOW)
 MAX31855 myMAX31855_02(4); //for ESP8266 change to D4 (fails to BOOT/FLASH if pin LOW)
 
+MAX31855 *mySensors[] = {&myMAX31855_01, &myMAX31855_02};
+
 void setup()
 {
   Serial.begin(115200);
 
-  /* start MAX31855 */
-  myMAX31855_01.begin();
-  myMAX31855_02.begin();
+  /* start all MAX31855 in one shared power-up window */
+  MAX31855::beginAll(mySensors, 2);
 
   while (myMAX31855_01.getChipID() != MAX31855_ID)
   {
@@ -126,26 +126,25 @@ void loop()
     delay(5000);
   }
 
-  rawData_01 = myMAX31855_01.readRawData();
-  rawData_02 = myMAX31855_02.readRawData();
+  MAX31855::readRawDataAll(mySensors, rawData, 2); //both sensors are converted in parallel & read in one sweep
 
   Serial.print(F("Chip_ID_01: "));
-  Serial.println(myMAX31855_01.getChipID(rawData_01)); //if ChipID != 31855, then you have read fail=2 or unknown error=2000
+  Serial.println(myMAX31855_01.getChipID(rawData[0])); //if ChipID != 31855, then you have read fail=2 or unknown error=2000
 
   Serial.print(F("Chip_ID_02: "));
-  Serial.println(myMAX31855_02.getChipID(rawData_02));
+  Serial.println(myMAX31855_02.getChipID(rawData[1]));
 
   Serial.print(F("Cold_Junction_01: "));
-  Serial.println(myMAX31855_01.getColdJunctionTemperature(rawData_01));
+  Serial.println(myMAX31855_01.getColdJunctionTemperature(rawData[0]));
 
   Serial.print(F("Cold_Junction_02: "));
-  Serial.println(myMAX31855_02.getColdJunctionTemperature(rawData_02));
+  Serial.println(myMAX31855_02.getColdJunctionTemperature(rawData[1]));
 
   Serial.print(F("Thermocouple_01: "));
-  Serial.println(myMAX31855_01.getTemperature(rawData_01));
+  Serial.println(myMAX31855_01.getTemperature(rawData[0]));
 
   Serial.print(F("Thermocouple_02: "));
-  Serial.println(myMAX31855_02.getTemperature(rawData_02));
+  Serial.println(myMAX31855_02.getTemperature(rawData[1]));
 
   delay(5000);
 }
@@ -61,6 +61,9 @@ void setup()
   /* start MAX31855 */
   myMAX31855.begin();
 
+  /* mask interrupts for one SCK clock only, ISR latency stays low */
+  myMAX31855.setInterruptPolicy(MAX31855_IRQ_EDGE);
+
   while (myMAX31855.getChipID() != MAX31855_ID)
   {
     Serial.println(F("MAX6675 error")); //(F()) saves string to flash & keeps dynamic memory free
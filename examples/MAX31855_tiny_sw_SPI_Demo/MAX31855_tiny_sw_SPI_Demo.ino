@@ -0,0 +1,90 @@
+/***************************************************************************************************/
+/* 
+   Example for 14-bit MAX31855 K-Thermocouple to Digital Converter with Cold Junction Compensation,
+   tiny footprint version for ATtiny & other 4..8KB flash mcu
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+     Optimal performance of cold junction compensation happends when the thermocouple cold junction
+     & the MAX31855 are at the same temperature. Avoid placing heat-generating devices or components
+     near the converter because this may produce an errors.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+
+   Board:                                     Level
+   ATtiny85, ATtiny45, ATtiny25.............  3v/5v
+   ATtiny84, ATtiny44, ATtiny24.............  3v/5v
+   Uno, Mini, Pro, ATmega168, ATmega328.....  5v
+
+   Size benchmark:
+   - compile this sketch & MAX31855_sw_SPI_Demo for the same board, compare flash & RAM
+     reported by IDE, "Sketch uses ... bytes" & "Global variables use ... bytes"
+   - uncomment MAX31855_TINY_NO_FAULT_DETAIL in MAX31855tiny.h to strip fault details
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#include <MAX31855tiny.h>
+
+int32_t rawData     = 0;
+int16_t temperature = 0;
+
+/*
+  MAX31855tiny(cs, so, sck)
+
+  cs  - chip select
+  so  - serial data output
+  sck - serial clock input
+*/
+
+MAX31855tiny myMAX31855(3, 4, 2); //for ATtiny85 Serial TX is on PB0 by default
+
+
+void setup()
+{
+  Serial.begin(9600);
+
+  /* start MAX31855 */
+  myMAX31855.begin();
+
+  while (myMAX31855.getChipID() != MAX31855_ID)
+  {
+    Serial.println(F("MAX31855 error")); //(F()) saves string to flash & keeps dynamic memory free
+    delay(5000);
+  }
+  Serial.println(F("MAX31855 OK"));
+}
+
+void loop()
+{
+  rawData = myMAX31855.readRawData();
+
+  if (myMAX31855.detectThermocouple(rawData) != MAX31855_THERMOCOUPLE_OK)
+  {
+    Serial.println(F("Thermocouple error"));
+    delay(5000);
+    return;
+  }
+
+  temperature = myMAX31855.getTemperature(rawData);         //in 0.25°C
+
+  Serial.print(F("Thermocouple, 1/100C: "));
+  Serial.println((int32_t)temperature * 25);                //0.25°C is 25/100°C, no floating point
+
+  temperature = myMAX31855.getColdJunctionTemperature(rawData); //in 0.0625°C
+
+  Serial.print(F("Cold Junction, 1/16C: "));
+  Serial.println(temperature);
+
+  delay(5000);
+}
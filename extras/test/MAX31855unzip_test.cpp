@@ -0,0 +1,105 @@
+/***************************************************************************************************/
+/*
+   Host unit test of MAX31855unzip::deinterleave(), quad SPI stream de-interleave kernel
+
+   - builds quad stream from known frames bit by bit, the way ESP32 SPI controller
+     receives it, & checks that the kernel gets the same frames back
+   - walking single bit, all zeros, all ones & 100000 pseudo random frame sets
+
+   build & run on the host from the library root:
+   g++ -std=c++11 -Wall -Isrc extras/test/MAX31855unzip_test.cpp src/MAX31855unzip.cpp -o unzip_test && ./unzip_test
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <MAX31855unzip.h>
+
+static uint32_t seed     = 1;
+static uint32_t failures = 0;
+
+
+/* reference, bit D31..D0 of line n is bit n of nibble 0..31, the first nibble is in bits 7..4 */
+static void interleave(const uint32_t frame[], uint8_t stream[])
+{
+  uint8_t nibble;
+
+  memset(stream, 0, MAX31855_QUAD_STREAM);
+
+  for (uint8_t clock = 0; clock < 32; clock++)
+  {
+    nibble = 0;
+
+    for (uint8_t line = 0; line < MAX31855_QUAD_LINES; line++) nibble |= ((frame[line] >> (31 - clock)) & 0x01) << line;
+
+    stream[clock / 2] |= (clock % 2 == 0) ? (nibble << 4) : nibble;
+  }
+}
+
+static void check(const uint32_t frame[])
+{
+  uint8_t stream[MAX31855_QUAD_STREAM];
+  int32_t rawData[MAX31855_QUAD_LINES];
+
+  interleave(frame, stream);
+
+  MAX31855unzip::deinterleave(stream, rawData);
+
+  for (uint8_t line = 0; line < MAX31855_QUAD_LINES; line++)
+  {
+    if ((uint32_t)rawData[line] == frame[line]) continue;
+
+    if (failures++ < 10) printf("line %u: expected 0x%08X, got 0x%08X\n", line, (unsigned)frame[line], (unsigned)rawData[line]);
+  }
+}
+
+static uint32_t random32(void)
+{
+  seed = (seed * 1664525UL) + 1013904223UL;                        //LCG, the same sequence on every host
+
+  return seed;
+}
+
+int main(void)
+{
+  uint32_t frame[MAX31855_QUAD_LINES];
+
+  /* all zeros & all ones */
+  memset(frame, 0x00, sizeof(frame));
+  check(frame);
+  memset(frame, 0xFF, sizeof(frame));
+  check(frame);
+
+  /* walking single bit on every line */
+  for (uint8_t line = 0; line < MAX31855_QUAD_LINES; line++)
+  {
+    for (uint8_t bit = 0; bit < 32; bit++)
+    {
+      memset(frame, 0x00, sizeof(frame));
+      frame[line] = 1UL << bit;
+      check(frame);
+    }
+  }
+
+  /* pseudo random frames */
+  for (uint32_t i = 0; i < 100000; i++)
+  {
+    for (uint8_t line = 0; line < MAX31855_QUAD_LINES; line++) frame[line] = random32();
+
+    check(frame);
+  }
+
+  if (failures != 0)
+  {
+    printf("FAIL, %u errors\n", (unsigned)failures);
+    return 1;
+  }
+
+  printf("PASS\n");
+  return 0;
+}
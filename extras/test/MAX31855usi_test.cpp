@@ -0,0 +1,194 @@
+/***************************************************************************************************/
+/*
+   Host unit test of MAX31855usi frame assembly, ATtiny USI three-wire mode
+
+   - USI model follows ATtiny25/45/85 datasheet, USICR write toggles USCK if USITC is set,
+     with external positive edge clock & USITC strobe DI is shifted on USCK rising edge,
+     with software clock strobe DI is shifted after USCK is toggled, worst case of the same
+     write, so driver, which samples on falling edge, fails this test
+   - MAX31855 model drives D31 on CS falling edge & next bit on every SCK falling edge,
+     new conversion starts on CS rising edge & takes 100msec
+   - checks bits order, 32 SCK clocks per frame, SCK idle low, power-up & conversion time
+     & decoding of known frames, all zeros, all ones, walking bit & pseudo random frames
+
+   build & run on the host from the library root, repeat with -DF_CPU=16000000UL for nop path:
+   g++ -std=c++11 -Wall -DARDUINO=10800 -D__AVR_ATtiny85__ -DF_CPU=8000000UL -Iextras/test/host -Isrc extras/test/MAX31855usi_test.cpp src/MAX31855usi.cpp src/MAX31855.cpp -o usi_test && ./usi_test
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#include <stdio.h>
+#include <SPI.h>
+#include <MAX31855usi.h>
+
+#define CS_PIN 3
+
+static uint32_t seed     = 1;
+static uint32_t failures = 0;
+static uint32_t timeNow  = 0;                                      //in microseconds
+
+/* MAX31855 model */
+static uint32_t chipFrame     = 0;
+static uint8_t  chipBit       = 32;                                //next bit on SO, 32 - SO is hi-Z
+static uint8_t  chipClocks    = 0;                                 //SCK falling edges since CS low
+static bool     chipSelected  = false;
+static uint32_t chipStartTime = 0;                                 //conversion start, CS rising edge
+static bool     chipEarlyRead = false;                             //SCK was clocked before conversion end
+
+/* USI model */
+static uint8_t  usck          = LOW;
+static uint8_t  usiCounter    = 0;                                 //4-bit counter, counts both USCK edges
+
+UsiControl       USICR;
+volatile uint8_t USIDR = 0;
+volatile uint8_t DDRB  = 0;
+SPIClass         SPI;
+
+
+uint32_t millis(void)                 {return timeNow / 1000;}
+uint32_t micros(void)                 {return timeNow;}
+void     delay(uint32_t ms)           {timeNow += ms * 1000;}
+void     delayMicroseconds(uint32_t us) {timeNow += us;}
+void     pinMode(uint8_t, uint8_t)    {}
+int      digitalRead(uint8_t)         {return LOW;}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+  if (pin != CS_PIN) return;
+
+  if (value == LOW)
+  {
+    chipSelected = true;
+    chipBit      = 0;                                              //D31 is on SO after CS falling edge
+    chipClocks   = 0;
+  }
+  else
+  {
+    if (chipSelected == true) chipStartTime = timeNow;             //new conversion
+
+    chipSelected = false;
+    chipBit      = 32;
+  }
+}
+
+static uint8_t chipSO(void)
+{
+  if (chipSelected == false || chipBit > 31) return LOW;
+
+  return (chipFrame >> (31 - chipBit)) & 0x01;
+}
+
+static void chipClock(uint8_t level)
+{
+  if (chipSelected == false) return;
+
+  if (level == HIGH && chipClocks == 0 && (timeNow - chipStartTime) < 100000UL) chipEarlyRead = true;
+
+  if (level == LOW)
+  {
+    chipClocks++;
+
+    if (chipBit < 32) chipBit++;                                   //next bit on SCK falling edge
+  }
+}
+
+static void usiShift(void)
+{
+  USIDR = (USIDR << 1) | chipSO();
+}
+
+UsiControl &UsiControl::operator=(uint8_t value)
+{
+  bool threeWire = (value & _BV(USIWM0)) != 0;
+  bool external  = (value & _BV(USICS1)) != 0;
+
+  if (threeWire == false || (DDRB & _BV(PB2)) == 0 || (DDRB & _BV(PB0)) != 0) return *this; //USCK must be output & DI input
+
+  if (value & _BV(USITC))
+  {
+    usck = (usck == LOW) ? HIGH : LOW;
+
+    chipClock(usck);
+
+    if (external == true && usck == HIGH && (value & _BV(USICLK))) usiShift(); //external positive edge, USITC strobe
+    if (external == true && (value & _BV(USICLK)))                 usiCounter = (usiCounter + 1) & 0x0F;
+  }
+
+  if (external == false && (value & _BV(USICLK)))                  //software clock strobe, shift after toggle
+  {
+    usiShift();
+    usiCounter = (usiCounter + 1) & 0x0F;
+  }
+
+  return *this;
+}
+
+
+class MAX31855usiTest : public MAX31855usi                         //readFrame() is protected
+{
+  public:
+   MAX31855usiTest(uint8_t cs) : MAX31855usi(cs) {}
+};
+
+static uint32_t random32(void)
+{
+  seed = (seed * 1664525UL) + 1013904223UL;                        //LCG, the same sequence on every host
+
+  return seed;
+}
+
+static void check(MAX31855usiTest &sensor, uint32_t frame)
+{
+  int32_t rawData;
+
+  chipFrame     = frame;
+  chipEarlyRead = false;
+
+  rawData = sensor.readRawData();
+
+  if ((uint32_t)rawData != frame || chipClocks != 32 || usck != LOW || usiCounter != 0 || chipEarlyRead == true)
+  {
+    if (failures++ < 10) printf("frame 0x%08X: got 0x%08X, clocks %u, usck %u, counter %u, early %u\n",
+                                (unsigned)frame, (unsigned)rawData, chipClocks, usck, usiCounter, chipEarlyRead);
+  }
+}
+
+int main(void)
+{
+  MAX31855usiTest sensor(CS_PIN);
+
+  sensor.begin();
+
+  /* edge cases */
+  check(sensor, 0x00000000);
+  check(sensor, 0xFFFFFFFF);
+  check(sensor, 0xAAAAAAAA);
+  check(sensor, 0x55555555);
+
+  for (uint8_t bit = 0; bit < 32; bit++) check(sensor, 1UL << bit);
+
+  /* pseudo random frames */
+  for (uint16_t i = 0; i < 10000; i++) check(sensor, random32());
+
+  /* decoding, +100°C thermocouple & +25°C cold junction */
+  chipFrame = (400UL << 18) | (400UL << 4);
+
+  if (sensor.getTemperatureCode(sensor.readRawData()) != 400 || sensor.getColdJunctionCode(sensor.readRawData()) != 400)
+  {
+    failures++;
+    printf("decoding of known frame failed\n");
+  }
+
+  if (failures != 0)
+  {
+    printf("FAIL, %u errors\n", (unsigned)failures);
+    return 1;
+  }
+
+  printf("PASS\n");
+  return 0;
+}
@@ -0,0 +1,66 @@
+/***************************************************************************************************/
+/*
+   Minimal Arduino API for host unit tests, only what the tested drivers use
+
+   - time is simulated, delay() advances millis() & micros() instantly
+   - pins & AVR USI registers are provided by the test, see MAX31855usi_test.cpp
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HIGH   1
+#define LOW    0
+#define INPUT  0
+#define OUTPUT 1
+
+#define MSBFIRST  1
+#define SPI_MODE0 0
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define highByte(w)         ((uint8_t)((w) >> 8))
+#define lowByte(w)          ((uint8_t)((w) & 0xFF))
+
+#define _BV(bit)            (1 << (bit))
+
+#define min(a, b)           ((a) < (b) ? (a) : (b))
+#define max(a, b)           ((a) > (b) ? (a) : (b))
+
+uint32_t millis(void);
+uint32_t micros(void);
+void     delay(uint32_t ms);
+void     delayMicroseconds(uint32_t us);
+void     pinMode(uint8_t pin, uint8_t mode);
+void     digitalWrite(uint8_t pin, uint8_t value);
+int      digitalRead(uint8_t pin);
+
+inline void noInterrupts(void) {}
+inline void interrupts(void)   {}
+
+/* ATtiny85 USI & port B registers, see ATtiny25/45/85 datasheet */
+#define USIWM0 4
+#define USICS1 3
+#define USICLK 1
+#define USITC  0
+
+#define PB0    0
+#define PB2    2
+
+class UsiControl                                         //USI control register, writes clock the USI model
+{
+  public:
+   UsiControl &operator=(uint8_t value);
+};
+
+extern UsiControl       USICR;
+extern volatile uint8_t USIDR;
+extern volatile uint8_t DDRB;
+
+#endif
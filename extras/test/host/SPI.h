@@ -0,0 +1,31 @@
+/***************************************************************************************************/
+/*
+   Minimal hw SPI API for host unit tests, MAX31855.cpp is linked, but hw SPI is not used
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#ifndef SPI_h
+#define SPI_h
+
+#include <Arduino.h>
+
+class SPISettings
+{
+  public:
+   SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass
+{
+  public:
+   void     begin(void)                   {}
+   void     beginTransaction(SPISettings) {}
+   void     endTransaction(void)          {}
+   uint16_t transfer16(uint16_t)          {return 0;}
+};
+
+extern SPIClass SPI;
+
+#endif
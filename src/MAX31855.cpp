@@ -45,6 +45,21 @@
 /***************************************************************************************************/
 
 #include <MAX31855.h>
+#include <SPI.h>
+
+#if defined(__AVR__)
+#include <avr/sleep.h>                                    //for Arduino AVR idle sleep during conversion
+#elif defined(ESP8266)
+extern "C" {
+#include <user_interface.h>                               //for Arduino ESP8266 forced light sleep during conversion
+}
+#elif defined(ESP32)
+#include <esp_sleep.h>                                    //for Arduino ESP32 light sleep during conversion
+#endif
+
+#ifdef MAX31855_EEPROM_SUPPORT
+#include <EEPROM.h>
+#endif
 
 
 /**************************************************************************/
@@ -59,24 +74,123 @@
 /**************************************************************************/
 MAX31855::MAX31855(uint8_t cs)
 {
-  _cs = cs; //cs chip select
+  _cs              = cs;                  //cs chip select
+  _spi             = &SPI;                //default hw SPI bus
+  _spiClock        = MAX31855_SPI_CLOCK;
+  _lowPower        = false;               //busy-wait during conversion
+  _conversionTime  = MAX31855_CONVERSION_TIME;
+  _powerUp         = false;               //power-up time is counted by begin()
+  _powerUpTime     = 0;
+  _offset          = 0;                   //no calibration
+  _gain            = MAX31855_GAIN_UNITY;
+
+  _alarmHigh       = INT16_MAX;           //alarm is disabled, thresholds are out of 14-bit range
+  _alarmLow        = INT16_MIN;
+  _alarmHysteresis = 0;
+  _alarmState      = MAX31855_ALARM_OFF;
+
+  _sampleMicros    = 0;
+  _readMicros      = 0;
+  _nominalPeriod   = 0;                   //jitter is not measured
+  _samplePeriod    = 0;                   //periodic sampling is not configured
+  _sampleSlot      = 0;
+  _skippedSamples  = 0;
+  _converting      = false;
+  _rawData         = 0;
+
+  updateAlarm();
+  resetJitter();
+}
+
+/**************************************************************************/
+/*
+    MAX31855()
+
+    Constructor for hardware read only SPI on specific SPI bus
+
+    NOTE:
+    - cs is chip select, set cs low to enable serial interface
+    - spi is hw SPI bus, for example ESP32 SPIClass(HSPI) or
+      STM32 SPIClass(PB15, PB14, PB13) for SPI2, sensors on different
+      buses can be read in parallel from different RTOS tasks
+*/
+/**************************************************************************/
+#ifndef MAX31855_SOFT_SPI
+MAX31855::MAX31855(uint8_t cs, SPIClass &spi) : MAX31855(cs)
+{
+  _spi = &spi;
 }
+#endif
 
 /**************************************************************************/
 /*
     begin()
 
-    Initializes & configures hardware SPI
+    Initializes & configures SPI, waits until power-up is completed
 */
 /**************************************************************************/
 void MAX31855::begin(void)
+{
+  beginNoWait();
+  waitPowerUp();
+}
+
+/**************************************************************************/
+/*
+    beginNoWait()
+
+    Initializes & configures hardware SPI without waiting for power-up
+
+    NOTE:
+    - power-up deadline is stored & honored by the first read, use
+      isReady() to check if power-up is completed
+*/
+/**************************************************************************/
+void MAX31855::beginNoWait(void)
 {
   pinMode(_cs, OUTPUT);
   digitalWrite(_cs, HIGH);                  //disables SPI interface for MAX31855, but it will initiate measurement/conversion
 
-  SPI.begin();                              //setting hardware SCK, MOSI, SS to output, pull SCK, MOSI low & SS high    
+  ((SPIClass *)_spi)->begin();              //setting hardware SCK, MOSI, SS to output, pull SCK, MOSI low & SS high    
+
+  _powerUpTime = millis();
+  _powerUp     = true;
+}
+
+/**************************************************************************/
+/*
+    isReady()
+
+    Checks if power-up time is elapsed
+
+    NOTE:
+    - read before power-up time is elapsed blocks until it is completed
+*/
+/**************************************************************************/
+bool MAX31855::isReady(void)
+{
+  if (_powerUp == true && (millis() - _powerUpTime) < MAX31855_CONVERSION_POWER_UP_TIME) return false;
+
+  _powerUp = false;
 
-  delay(MAX31855_CONVERSION_POWER_UP_TIME);
+  return true;
+}
+
+/**************************************************************************/
+/*
+    beginAll()
+
+    Initializes all sensors & waits for power-up only once
+
+    NOTE:
+    - all sensors power-up in one shared 200msec window, instead of
+      200msec per sensor
+*/
+/**************************************************************************/
+void MAX31855::beginAll(MAX31855 *sensor[], uint8_t quantity)
+{
+  for (uint8_t i = 0; i < quantity; i++) sensor[i]->beginNoWait();
+  for (uint8_t i = 0; i < quantity; i++) sensor[i]->waitPowerUp(); //only the 1-st wait is long, the rest are already elapsed
 }
 
 /**************************************************************************/
@@ -155,13 +269,11 @@ uint16_t MAX31855::getChipID(int32_t rawValue)
 /**************************************************************************/
 float MAX31855::getTemperature(int32_t rawValue)
 {
-  if (rawValue == MAX31855_FORCE_READ_DATA) rawValue = readRawData();
-
-  if (detectThermocouple(rawValue) != MAX31855_THERMOCOUPLE_OK) return MAX31855_ERROR;
+  int16_t code = getTemperatureCode(rawValue);
 
-  rawValue = rawValue >> 18; //clear D17..D0 bits
+  if (code == MAX31855_ERROR_CODE) return MAX31855_ERROR;
 
-  return (float)rawValue * MAX31855_THERMOCOUPLE_RESOLUTION;
+  return (float)code * MAX31855_THERMOCOUPLE_RESOLUTION;
 }
 
 /**************************************************************************/
@@ -178,80 +290,1133 @@ float MAX31855::getTemperature(int32_t rawValue)
 */
 /**************************************************************************/
 float MAX31855::getColdJunctionTemperature(int32_t rawValue)
+{
+  int16_t code = getColdJunctionCode(rawValue);
+
+  if (code == MAX31855_ERROR_CODE) return MAX31855_ERROR;
+
+  return (float)code * MAX31855_COLD_JUNCTION_RESOLUTION;
+}
+
+/**************************************************************************/
+/*
+    getTemperatureCode()
+
+    Reads calibrated Temperature, in 0.25°C steps
+
+    NOTE:
+    - integer only, -270°C..+1372°C is -1080..+5488, divide by 4 to get °C
+    - returns MAX31855_ERROR_CODE if thermocouple is open/shorted or
+      read fail
+    - calibration costs one multiply & shift, see setCalibration()
+*/
+/**************************************************************************/
+int16_t MAX31855::getTemperatureCode(int32_t rawValue)
+{
+  int16_t code;
+
+  if (rawValue == MAX31855_FORCE_READ_DATA) rawValue = readRawData();
+
+  if (detectThermocouple(rawValue) != MAX31855_THERMOCOUPLE_OK) return MAX31855_ERROR_CODE;
+
+  code = rawValue >> 18;                                             //clear D17..D0 bits, arithmetic shift keeps the sign
+
+  return calibrate(code);
+}
+
+/**************************************************************************/
+/*
+    getColdJunctionCode()
+
+    Reads cold junction Temperature, in 0.0625°C steps
+
+    NOTE:
+    - integer only, -40°C..+125°C is -640..+2000, divide by 16 to get °C
+    - bit D15 is the sign, so D15..D4 are decoded as 12-bit signed value
+    - returns MAX31855_ERROR_CODE if read fail or not MAX31855
+*/
+/**************************************************************************/
+int16_t MAX31855::getColdJunctionCode(int32_t rawValue)
 {
   if (rawValue == MAX31855_FORCE_READ_DATA) rawValue = readRawData();
 
-  if (getChipID(rawValue) != MAX31855_ID) return MAX31855_ERROR;
+  if (getChipID(rawValue) != MAX31855_ID) return MAX31855_ERROR_CODE;
+
+  return (int16_t)rawValue >> 4;                                     //clear D31..D16 & D3..D0 bits
+}
+
+/**************************************************************************/
+/*
+    setCalibration()
+
+    Sets two-point calibration of thermocouple temperature
+
+    NOTE:
+    - calibrated code = code * gain / 32768 + offset
+    - offset in 0.25°C steps, for example -6 is -1.5°C
+    - gain in Q15 format, 32768 is 1.0, 1..65535 is 0.00003..1.99998
+    - for two bath points code1/ref1 & code2/ref2 (0.25°C steps)
+      gain   = 32768 * (ref2 - ref1) / (code2 - code1)
+      offset = ref1 - code1 * gain / 32768
+    - returns false & keeps current calibration if gain is 0, every
+      temperature would be equal to offset
+*/
+/**************************************************************************/
+bool MAX31855::setCalibration(int16_t offset, uint16_t gain)
+{
+  if (gain == 0) return false;
+
+  _offset = offset;
+  _gain   = gain;
+
+  updateAlarm();
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    setAlarm()
+
+    Sets high & low alarm thresholds with hysteresis, in °C
+
+    NOTE:
+    - thresholds are converted once to raw 14-bit codes, calibration
+      is taken into account, see checkAlarm()
+    - high alarm is set when temperature >= high & cleared when
+      temperature < high - hysteresis
+    - low alarm is set when temperature <= low & cleared when
+      temperature > low + hysteresis
+*/
+/**************************************************************************/
+void MAX31855::setAlarm(float high, float low, float hysteresis)
+{
+  _alarmHigh       = (high >= 0) ? (high / MAX31855_THERMOCOUPLE_RESOLUTION + 0.5) : (high / MAX31855_THERMOCOUPLE_RESOLUTION - 0.5);
+  _alarmLow        = (low  >= 0) ? (low  / MAX31855_THERMOCOUPLE_RESOLUTION + 0.5) : (low  / MAX31855_THERMOCOUPLE_RESOLUTION - 0.5);
+  _alarmHysteresis = abs(hysteresis) / MAX31855_THERMOCOUPLE_RESOLUTION + 0.5;
+  _alarmState      = MAX31855_ALARM_OFF;
+
+  updateAlarm();
+}
+
+/**************************************************************************/
+/*
+    checkAlarm()
+
+    Checks alarm thresholds & updates alarm state
+
+    Return:
+    - 0 no alarm
+    - 1 high alarm
+    - 2 low alarm
+    - 3 thermocouple open/shorted or read fail
+
+    NOTE:
+    - integer compare of D31..D18 bits with precalculated raw thresholds,
+      no float & no calibration math, safe to call from ISR right after
+      the frame is read
+*/
+/**************************************************************************/
+uint8_t MAX31855::checkAlarm(int32_t rawValue)
+{
+  int16_t code;
+  uint8_t state = _alarmState;
+
+  if (rawValue == 0 || bitRead(rawValue, 16) == 1)
+  {
+    _alarmState = MAX31855_ALARM_FAULT;
+
+    return MAX31855_ALARM_FAULT;
+  }
+
+  code = rawValue >> 18;                                             //clear D17..D0 bits, arithmetic shift keeps the sign
+
+  if      (state == MAX31855_ALARM_HIGH && code < _alarmHighClear) state = MAX31855_ALARM_OFF;
+  else if (state == MAX31855_ALARM_LOW  && code > _alarmLowClear)  state = MAX31855_ALARM_OFF;
+  else if (state == MAX31855_ALARM_FAULT)                          state = MAX31855_ALARM_OFF;
+
+  if (state == MAX31855_ALARM_OFF)
+  {
+    if      (code >= _alarmHighSet) state = MAX31855_ALARM_HIGH;
+    else if (code <= _alarmLowSet)  state = MAX31855_ALARM_LOW;
+  }
+
+  _alarmState = state;
+
+  return state;
+}
+
+/**************************************************************************/
+/*
+    getAlarm()
+
+    Returns alarm state from the last checkAlarm()
+*/
+/**************************************************************************/
+uint8_t MAX31855::getAlarm(void)
+{
+  return _alarmState;
+}
+
+#ifdef MAX31855_EEPROM_SUPPORT
+/**************************************************************************/
+/*
+    saveCalibration()
+
+    Saves calibration to EEPROM with CRC8
+
+    NOTE:
+    - uses MAX31855_CALIBRATION_SIZE bytes starting from address
+    - ESP8266/ESP32, call EEPROM.begin(size) before, data is committed
+      to flash here
+*/
+/**************************************************************************/
+bool MAX31855::saveCalibration(uint16_t address)
+{
+  uint8_t data[MAX31855_CALIBRATION_SIZE];
+
+  data[0] = highByte(_offset);
+  data[1] = lowByte(_offset);
+  data[2] = highByte(_gain);
+  data[3] = lowByte(_gain);
+  data[4] = crc8(data, MAX31855_CALIBRATION_SIZE - 1);
+
+  for (uint8_t i = 0; i < MAX31855_CALIBRATION_SIZE; i++)
+  {
+    #if defined(__AVR__)
+    EEPROM.update(address + i, data[i]);                               //write only changed bytes, saves EEPROM life
+    #else
+    EEPROM.write(address + i, data[i]);
+    #endif
+  }
+
+  #if defined(ESP8266) || defined(ESP32)
+  return EEPROM.commit();
+  #else
+  return true;
+  #endif
+}
+
+/**************************************************************************/
+/*
+    loadCalibration()
+
+    Loads calibration from EEPROM & checks CRC8
+
+    NOTE:
+    - returns false & keeps current calibration if CRC8 is wrong
+      or gain is 0
+    - alarm thresholds are re-mapped to loaded calibration
+    - ESP8266/ESP32, call EEPROM.begin(size) before
+*/
+/**************************************************************************/
+bool MAX31855::loadCalibration(uint16_t address)
+{
+  uint8_t data[MAX31855_CALIBRATION_SIZE];
+
+  for (uint8_t i = 0; i < MAX31855_CALIBRATION_SIZE; i++) data[i] = EEPROM.read(address + i);
+
+  if (crc8(data, MAX31855_CALIBRATION_SIZE - 1) != data[4]) return false;
+
+  return setCalibration((int16_t)(((uint16_t)data[0] << 8) | data[1]), ((uint16_t)data[2] << 8) | data[3]); //re-maps alarm thresholds too
+}
+#endif
+
+/**************************************************************************/
+/*
+    calibrate()
+
+    Applies calibration to raw 14-bit code
+
+    NOTE:
+    - Q15 gain with rounding & offset, one multiply & shift
+*/
+/**************************************************************************/
+int16_t MAX31855::calibrate(int16_t code)
+{
+  return ((((int32_t)code * _gain) + (MAX31855_GAIN_UNITY / 2)) >> 15) + _offset;
+}
+
+/**************************************************************************/
+/*
+    findCode()
+
+    Finds the smallest raw 14-bit code, which calibrated value is >= code
+
+    NOTE:
+    - binary search over -8192..+8191, 14 steps
+    - returns 8192 if there is no such code
+*/
+/**************************************************************************/
+int16_t MAX31855::findCode(int16_t code)
+{
+  int16_t low  = -8192;
+  int16_t high = 8192;
+
+  while (low < high)
+  {
+    int16_t middle = low + ((high - low) >> 1);
+
+    if (calibrate(middle) >= code) high = middle;
+    else                           low  = middle + 1;
+  }
+
+  return low;
+}
+
+/**************************************************************************/
+/*
+    updateAlarm()
+
+    Converts alarm thresholds to raw 14-bit codes
+
+    NOTE:
+    - called after alarm or calibration is changed
+*/
+/**************************************************************************/
+void MAX31855::updateAlarm(void)
+{
+  _alarmHighSet   = findCode(_alarmHigh);
+  _alarmHighClear = findCode(_alarmHigh - _alarmHysteresis);
+  _alarmLowSet    = findCode(_alarmLow + 1) - 1;                     //the largest code, which calibrated value is <= low
+  _alarmLowClear  = findCode(_alarmLow + _alarmHysteresis + 1) - 1;
+}
+
+/**************************************************************************/
+/*
+    crc8()
+
+    Calculates Dallas/Maxim CRC8 polynomial with non-zero init
+
+    NOTE:
+    - polynomial x^8 + x^5 + x^4 + 1, 0x31 or 0x8C reflected, init 0xFF
+    - init 0x00 gives CRC 0x00 for all-zero data, so zeroed EEPROM would
+      pass the check, init 0xFF doesn't
+*/
+/**************************************************************************/
+uint8_t MAX31855::crc8(const uint8_t *data, uint8_t length)
+{
+  uint8_t crc = 0xFF;
+
+  while (length--)
+  {
+    crc ^= *data++;
 
-  rawValue = rawValue & 0x0000FFFF; //clear D31..D16 bits
-  rawValue = rawValue >> 4;         //clear D3...D0  bits
+    for (uint8_t i = 8; i > 0; i--)
+    {
+      if (crc & 0x01) crc = (crc >> 1) ^ 0x8C;
+      else            crc = (crc >> 1);
+    }
+  }
 
-  return (float)rawValue * MAX31855_COLD_JUNCTION_RESOLUTION;
+  return crc;
 }
 
 /**************************************************************************/
 /*
     readRawData()
 
-    Reads raw data from MAX31855 via hardware SPI
+    Restarts measurement/conversion, waits until it is completed & reads
+    raw data from MAX31855
 
     NOTE:
-    - max SPI clock speed for MAX31855 is 5MHz
-    - in SPI_MODE0 data available shortly after the rising edge of SCK
-    - read of the cold-junction compensated thermocouple temperature requires
-      14 clock cycles
-    - read of the cold-junction compensated thermocouple temperature & reference
-      junction temperatures requires 32 clock cycles
     - forcing CS low immediately stops any conversion process, force CS high
       to initiate a new measurement process
-    - set CS low to enable the serial interface & force to output the first bit on the SO pin,
-      apply 14/32 clock signals at SCK to read the results at SO on the falling edge of the SCK
-    - bit D31 is the thermocouple temperature sign bit "+" is high & "-" is low,
-      if T+ & T- pins are unconnected it goes low
-    - bits D30..D18 contain the converted temperature in the order of MSB to LSB,
-      if T+ & T- pins are unconnected they go high
-    - bit D17 is low to provide a device ID for the MAX31855
-    - bit D16 is normally low & goes high if thermocouple is open, shorted to GND or VCC
-    - bit D15 is cold-junction temperature sign bit "+" is high & "-" is low
-    - bits D14..D4 contain cold-junction temperature in the order of MSB to LSB
-    - bit D3 is is low to provide a device ID for the MAX31855
-    - bit D2 is normally low & goes high to indicate a hermocouple short to VCC
-    - bit D1 is normally low & goes high to indicate a thermocouple short to GND
-    - bit D0 is normally low & goes high to indicate a thermocouple open circuit
-
-    - 8-bit  16MHz  AVR  one clock cycle is 62.5nS
-    - 32-bit 80MHz/180 ESP8266 one clock cycle is 12.5nS/5.5nS
-    - 32-bit 160MHz/250MHz ESP32 one clock cycle is 6.25nS/4nS
-    - 32-bit 72MHz STM32 one clock cycle is 13.9nS
-    - arduino 8-bit AVR maximum SPI master clock speed is mcu speed/2,
-      for 5v-16MHz/ProMini speed is 16000000/2=8MHz 
-    - arduino ESP8266 maximum SPI master clock speed is 80000000=80MHz
-    - arduino STM32 maximum SPI master clock speed is mcu speed/2,
-      for STM32F103C8 speed is 72000000/2=36MHz
+    - the frame is read right after the conversion time is elapsed, so
+      the value is never older than one conversion
 */
 /**************************************************************************/
 int32_t MAX31855::readRawData(void)
 {
-  int32_t rawData = 0;
+  int32_t rawData;
 
-  digitalWrite(_cs, LOW);                                          //stop  measurement/conversion
-  delayMicroseconds(1);                                            //pulse fall time > 100nS
-  digitalWrite(_cs, HIGH);                                         //start measurement/conversion
+  startConversion();
+  waitConversion();
 
-  delay(MAX31855_CONVERSION_TIME);
+  rawData     = readFrame();
+  _readMicros = micros();
+
+  return rawData;
+}
+
+/**************************************************************************/
+/*
+    readRawDataAll()
+
+    Reads raw data from all sensors in one sweep
+
+    NOTE:
+    - conversions of all sensors are restarted back-to-back, the longest
+      conversion time is waited once & all frames are read one by one
+    - all sensors sample at the same instant & N sensors take ~100msec
+      instead of N * 100msec with readRawData()
+    - sensors may use different drivers, hw SPI, sw SPI, USI
+*/
+/**************************************************************************/
+void MAX31855::readRawDataAll(MAX31855 *sensor[], int32_t rawData[], uint8_t quantity)
+{
+  uint8_t longest = 0;
+
+  if (quantity == 0) return;
+
+  for (uint8_t i = 0; i < quantity; i++)
+  {
+    sensor[i]->startConversion();
+
+    if (sensor[i]->_conversionTime > sensor[longest]->_conversionTime) longest = i;
+  }
+
+  sensor[longest]->waitConversion();
+
+  for (uint8_t i = 0; i < quantity; i++)
+  {
+    rawData[i]             = sensor[i]->readFrame();
+    sensor[i]->_readMicros = micros();
+  }
+}
+
+/**************************************************************************/
+/*
+    getSampleTime()
+
+    Returns time when the last conversion was started, in millis() domain
+
+    NOTE:
+    - use it to timestamp samples for filters, predictors & logging
+    - valid for ~71 minutes after the sample, micros() overflow period
+*/
+/**************************************************************************/
+uint32_t MAX31855::getSampleTime(void)
+{
+  return millis() - (micros() - _sampleMicros) / 1000;
+}
+
+/**************************************************************************/
+/*
+    getSampleMicros()
+
+    Returns micros() captured at CS rising edge, which started the last
+    conversion
+*/
+/**************************************************************************/
+uint32_t MAX31855::getSampleMicros(void)
+{
+  return _sampleMicros;
+}
+
+/**************************************************************************/
+/*
+    getReadMicros()
+
+    Returns micros() captured after the last frame readout
+
+    NOTE:
+    - getReadMicros() - getSampleMicros() is the age of the sample when
+      readRawData() returned
+*/
+/**************************************************************************/
+uint32_t MAX31855::getReadMicros(void)
+{
+  return _readMicros;
+}
+
+/**************************************************************************/
+/*
+    setSamplePeriod()
+
+    Sets periodic sampling period in milliseconds, timeline starts now
+*/
+/**************************************************************************/
+void MAX31855::setSamplePeriod(uint32_t period)
+{
+  setSamplePeriod(period, millis());
+}
+
+/**************************************************************************/
+/*
+    setSamplePeriod()
+
+    Sets periodic sampling period & timeline start, in milliseconds
+
+    NOTE:
+    - conversions are started at startTime + k * period, see
+      readRawDataPeriodic()
+    - to align sample instants of many sensors use the same startTime
+      & read them by readRawDataPeriodicAll() or update(), blocking
+      readRawDataPeriodic() of one sensor makes the next one late by
+      conversion time & it skips its slot
+    - period must be > conversion time, see getConversionTime()
+    - nominal period for jitter measurement is set too
+*/
+/**************************************************************************/
+void MAX31855::setSamplePeriod(uint32_t period, uint32_t startTime)
+{
+  _samplePeriod   = period;
+  _sampleSlot     = startTime;
+  _skippedSamples = 0;
+
+  setNominalPeriod(period * 1000);
+}
+
+/**************************************************************************/
+/*
+    readRawDataPeriodic()
+
+    Waits for the next slot on absolute timeline & reads raw data
+
+    NOTE:
+    - slots are startTime + k * period, so read & loop() time doesn't
+      accumulate as drift, unlike readRawData() + delay(period)
+    - if loop() is late less than conversion time, conversion is started
+      immediately & the next slot stays on the timeline
+    - if loop() is late more, missed slots are skipped & counted, see
+      getSkippedSamples(), so timestamps stay uniform
+    - conversion starts at the slot & the frame is read one conversion
+      time later, see getSampleTime()
+    - same as readRawData() if period is not set
+    - for many sensors use readRawDataPeriodicAll()
+*/
+/**************************************************************************/
+int32_t MAX31855::readRawDataPeriodic(void)
+{
+  int32_t slotTime;
+  int32_t rawData;
+
+  if (_samplePeriod == 0) return readRawData();
+
+  waitPowerUp();
+
+  slotTime = getSlotTime();
+
+  if (slotTime > 0) delay(slotTime);                               //wait for the slot
+
+  _sampleSlot += _samplePeriod;                                    //next slot on absolute timeline
+
+  startConversion();
+  waitConversion();
+
+  rawData     = readFrame();
+  _readMicros = micros();
+
+  return rawData;
+}
+
+/**************************************************************************/
+/*
+    readRawDataPeriodicAll()
+
+    Waits for the next slot on absolute timeline & reads raw data from
+    all sensors in one sweep
+
+    NOTE:
+    - timeline of the first sensor is used for all, see setSamplePeriod(),
+      other sensors get the same slot & skipped samples count
+    - all conversions are started at the slot, the longest conversion
+      time is waited once, see readRawDataAll()
+    - same as readRawDataAll() if period of the first sensor is not set
+*/
+/**************************************************************************/
+void MAX31855::readRawDataPeriodicAll(MAX31855 *sensor[], int32_t rawData[], uint8_t quantity)
+{
+  int32_t slotTime;
+
+  if (quantity == 0) return;
+
+  if (sensor[0]->_samplePeriod != 0)
+  {
+    for (uint8_t i = 0; i < quantity; i++) sensor[i]->waitPowerUp();
+
+    slotTime = sensor[0]->getSlotTime();
+
+    if (slotTime > 0) delay(slotTime);                             //wait for the slot
+
+    sensor[0]->_sampleSlot += sensor[0]->_samplePeriod;            //next slot on absolute timeline
+
+    for (uint8_t i = 1; i < quantity; i++)
+    {
+      sensor[i]->_sampleSlot     = sensor[0]->_sampleSlot;
+      sensor[i]->_skippedSamples = sensor[0]->_skippedSamples;
+    }
+  }
+
+  readRawDataAll(sensor, rawData, quantity);
+}
+
+/**************************************************************************/
+/*
+    update()
+
+    Non-blocking acquisition, call it from loop() as often as possible
+
+    NOTE:
+    - starts conversion on the next slot of periodic timeline, see
+      setSamplePeriod(), or immediately if period is not set
+    - reads the frame when conversion time is elapsed & returns true,
+      see getRawData()
+    - never waits, so loop() can service many sensors & other tasks,
+      jitter is bounded by the loop() time
+    - returns false until power-up time is elapsed
+*/
+/**************************************************************************/
+bool MAX31855::update(void)
+{
+  if (_converting == true)
+  {
+    if ((micros() - _sampleMicros) < ((uint32_t)_conversionTime * 1000)) return false;
+
+    _rawData    = readFrame();
+    _readMicros = micros();
+    _converting = false;
+
+    return true;
+  }
+
+  if (isReady() == false) return false;
+
+  if (_samplePeriod != 0)
+  {
+    if (getSlotTime() > 0) return false;                           //too early
+
+    _sampleSlot += _samplePeriod;                                  //next slot on absolute timeline
+  }
+
+  startConversion();
+
+  _converting = true;
+
+  return false;
+}
+
+/**************************************************************************/
+/*
+    getRawData()
+
+    Returns raw data read by the last update()
+*/
+/**************************************************************************/
+int32_t MAX31855::getRawData(void)
+{
+  return _rawData;
+}
+
+/**************************************************************************/
+/*
+    getSlotTime()
+
+    Returns time left to the next slot of periodic timeline, in milliseconds
+
+    NOTE:
+    - > 0 early, <= 0 late
+    - if late more than conversion time, missed slots are skipped & counted
+*/
+/**************************************************************************/
+int32_t MAX31855::getSlotTime(void)
+{
+  int32_t  slotTime = millis() - _sampleSlot;                      //< 0 early, >= 0 late
+  uint32_t missedSlots;
+
+  if (slotTime >= _conversionTime)                                 //skip missed slots
+  {
+    missedSlots      = ((uint32_t)slotTime / _samplePeriod) + 1;
+
+    _sampleSlot     += missedSlots * _samplePeriod;
+    _skippedSamples += missedSlots;
+
+    slotTime = millis() - _sampleSlot;
+  }
+
+  return -slotTime;
+}
+
+/**************************************************************************/
+/*
+    getSkippedSamples()
+
+    Returns qnt. of slots skipped because loop() was late
+*/
+/**************************************************************************/
+uint32_t MAX31855::getSkippedSamples(void)
+{
+  return _skippedSamples;
+}
+
+/**************************************************************************/
+/*
+    setNominalPeriod()
+
+    Sets nominal sampling period for jitter measurement, in microseconds
+
+    NOTE:
+    - 0 disables jitter measurement
+    - jitter is the difference between the period of two successive
+      conversion starts & the nominal period
+*/
+/**************************************************************************/
+void MAX31855::setNominalPeriod(uint32_t period)
+{
+  _nominalPeriod = period;
+
+  resetJitter();
+}
+
+/**************************************************************************/
+/*
+    getJitterMax()
+
+    Returns maximum absolute sampling jitter, in microseconds
+*/
+/**************************************************************************/
+uint32_t MAX31855::getJitterMax(void)
+{
+  return _jitterMax;
+}
+
+/**************************************************************************/
+/*
+    getJitterMean()
+
+    Returns mean absolute sampling jitter, in microseconds
+*/
+/**************************************************************************/
+uint32_t MAX31855::getJitterMean(void)
+{
+  if (_jitterCount == 0) return 0;
+
+  return _jitterSum / _jitterCount;
+}
+
+/**************************************************************************/
+/*
+    resetJitter()
+
+    Clears jitter statistics
+
+    NOTE:
+    - previous conversion start is forgotten, so the period before reset
+      is not counted, 0 means "no previous start"
+    - conversion in progress keeps its start, update() needs it to wait
+      the conversion time
+*/
+/**************************************************************************/
+void MAX31855::resetJitter(void)
+{
+  _jitterMax   = 0;
+  _jitterSum   = 0;
+  _jitterCount = 0;
+
+  if (_converting == false) _sampleMicros = 0;
+}
+
+/**************************************************************************/
+/*
+    setLowPower()
+
+    Enables/disables low power wait during measurement/conversion
+
+    NOTE:
+    - AVR, mcu goes to idle sleep mode during conversion & wakes up by
+      timer0 overflow interrupt every ~1msec, SPI/UART/timers keep running
+    - ESP32, mcu goes to light sleep & wakes up by RTC timer when conversion
+      is completed, Wi-Fi/BT connection is not maintained during light sleep
+    - ESP8266 with Wi-Fi off, see WiFi.mode(WIFI_OFF), mcu goes to forced
+      light sleep & wakes up by RTC timer when conversion is completed
+    - ESP8266 with Wi-Fi on, forced light sleep is not possible, delay()
+      yields to SDK & only modem sleep set by WiFi.setSleepMode() is used
+    - other mcu, same as busy-wait
+*/
+/**************************************************************************/
+void MAX31855::setLowPower(bool enable)
+{
+  _lowPower = enable;
+}
+
+/**************************************************************************/
+/*
+    waitPowerUp()
+
+    Waits until power-up time is elapsed
+*/
+/**************************************************************************/
+void MAX31855::waitPowerUp(void)
+{
+  uint32_t elapsedTime;
+
+  if (_powerUp == false) return;
+
+  elapsedTime = millis() - _powerUpTime;
+
+  if (elapsedTime < MAX31855_CONVERSION_POWER_UP_TIME) delay(MAX31855_CONVERSION_POWER_UP_TIME - elapsedTime);
+
+  _powerUp = false;
+}
+
+/**************************************************************************/
+/*
+    setConversionTime()
+
+    Sets conversion wait time, in milliseconds
+
+    NOTE:
+    - datasheet maximum is 100msec, typical is 70msec
+    - too short wait stops conversion & the previous result is read
+*/
+/**************************************************************************/
+void MAX31855::setConversionTime(uint8_t time)
+{
+  _conversionTime = time;
+}
+
+/**************************************************************************/
+/*
+    getConversionTime()
+
+    Returns conversion wait time, in milliseconds
+*/
+/**************************************************************************/
+uint8_t MAX31855::getConversionTime(void)
+{
+  return _conversionTime;
+}
+
+/**************************************************************************/
+/*
+    measureConversionTime()
+
+    Measures actual conversion time of this chip & sets conversion wait
+    time with safety margin
+
+    Return:
+    - measured conversion time, in milliseconds
+    - 0 if it can't be measured, conversion wait time is not changed
+
+    NOTE:
+    - forcing CS low stops any conversion & the last completed result is
+      read, so the frame read after too short wait is the same as the
+      previous one
+    - every trial reads full conversion frame, restarts conversion, waits
+      & reads again, if the frame is changed the conversion was completed
+    - waits from 40msec to 100msec in 5msec steps are checked, the first
+      wait with changed frame is the result
+    - unchanged frame may also be a completed conversion with the same
+      value, so the result is never shorter than real conversion time,
+      noisy LSBs make it closer to real one
+    - input must change between conversions, LSB noise or drift, so
+      full 100msec conversions are compared first & 0 is returned after
+      trials + 1 conversions if all frames are the same, for example
+      steady bench temperature without noise
+    - takes up to ~10sec with 4 trials, thermocouple must be connected
+    - genuine chip is ~70msec, much shorter or longer time may indicate
+      a counterfeit chip
+*/
+/**************************************************************************/
+uint8_t MAX31855::measureConversionTime(uint8_t trials)
+{
+  int32_t previousData;
+  int32_t rawData;
+
+  startConversion();
+  delay(MAX31855_CONVERSION_TIME);
+  previousData = readFrame();                                      //completed conversion
+  rawData      = previousData;
+
+  for (uint8_t i = 0; i < trials && rawData == previousData; i++)  //steady input can't be measured
+  {
+    previousData = rawData;
+
+    if (detectThermocouple(previousData) != MAX31855_THERMOCOUPLE_OK) return 0;
+
+    startConversion();
+    delay(MAX31855_CONVERSION_TIME);
+    rawData = readFrame();                                         //completed conversion
+  }
+
+  if (rawData == previousData) return 0;
+
+  for (uint8_t wait = MAX31855_CONVERSION_TIME_MIN; wait <= MAX31855_CONVERSION_TIME; wait += MAX31855_CONVERSION_TIME_STEP)
+  {
+    for (uint8_t i = 0; i < trials; i++)
+    {
+      startConversion();
+      delay(MAX31855_CONVERSION_TIME);
+      previousData = readFrame();                                  //completed conversion
+
+      if (detectThermocouple(previousData) != MAX31855_THERMOCOUPLE_OK) return 0;
+
+      startConversion();
+      delay(wait);
+      rawData = readFrame();                                       //new or previous result
+
+      if (rawData != previousData)
+      {
+        _conversionTime = min(wait + MAX31855_CONVERSION_TIME_MARGIN, MAX31855_CONVERSION_TIME);
+
+        return wait;
+      }
+    }
+  }
+
+  return 0;
+}
+
+/**************************************************************************/
+/*
+    setSpiClock()
+
+    Sets hw SPI clock, in Hz
+
+    NOTE:
+    - chip maximum is 5MHz, long cable to remote board may need lower
+      clock, see tuneSpiClock()
+    - clock is rounded down by SPI driver to the nearest available divider,
+      for 16MHz AVR it is 4MHz, 2MHz, 1MHz..125kHz
+    - has no effect on software SPI
+*/
+/**************************************************************************/
+void MAX31855::setSpiClock(uint32_t clock)
+{
+  if (clock > MAX31855_SPI_CLOCK) clock = MAX31855_SPI_CLOCK;
+
+  _spiClock = clock;
+}
+
+/**************************************************************************/
+/*
+    getSpiClock()
+
+    Returns hw SPI clock, in Hz
+*/
+/**************************************************************************/
+uint32_t MAX31855::getSpiClock(void)
+{
+  return _spiClock;
+}
+
+/**************************************************************************/
+/*
+    tuneSpiClock()
+
+    Finds the fastest reliable hw SPI clock for this cable & sets it with
+    safety margin
+
+    Return:
+    - set SPI clock, in Hz
+    - 0 if reference frame is invalid or frames are not stable even at
+      the lowest clock, SPI clock is set to the lowest one
+
+    NOTE:
+    - reference frame is read at the lowest clock after full conversion
+    - forcing CS low stops any conversion & the last completed result is
+      read, so back-to-back frames are the same until new conversion is
+      completed ~70msec later
+    - clock is halved from 5MHz to 156kHz, the first clock with all
+      frames equal to reference frame & valid is the fastest reliable one
+    - valid frame has ID bits D17 & D3 low & fault bit D16 equal to
+      D2 | D1 | D0
+    - margin is one step slower than the fastest reliable clock, 5MHz is
+      chip maximum & is used without margin
+    - thermocouple may be disconnected, fault frame is valid reference too
+    - call after begin(), takes ~100msec
+    - has no effect on software SPI, it always passes at the first step
+*/
+/**************************************************************************/
+uint32_t MAX31855::tuneSpiClock(uint8_t trials)
+{
+  int32_t  reference;
+  int32_t  rawData;
+  uint32_t clock;
+  uint8_t  i;
+
+  _spiClock = MAX31855_SPI_CLOCK >> (MAX31855_SPI_CLOCK_STEPS - 1);  //the lowest clock
+  reference = readRawData();
+
+  if (getChipID(reference) != MAX31855_ID)                       return 0;
+  if (bitRead(reference, 16) != ((reference & 0x07) != 0))       return 0;
+
+  for (uint8_t step = 0; step < MAX31855_SPI_CLOCK_STEPS; step++)
+  {
+    clock     = MAX31855_SPI_CLOCK >> step;
+    _spiClock = clock;
+
+    for (i = 0; i < trials; i++)
+    {
+      rawData = readFrame();                                       //conversion is restarted & stopped again, register keeps reference
+
+      if (rawData != reference) break;
+    }
+
+    if (i == trials)                                               //all frames are equal to valid reference
+    {
+      if (step > 0 && step < (MAX31855_SPI_CLOCK_STEPS - 1)) clock >>= 1; //safety margin
+
+      _spiClock = clock;
+
+      return clock;
+    }
+  }
+
+  return 0;                                                        //unstable even at the lowest clock, it is kept
+}
+
+/**************************************************************************/
+/*
+    startConversion()
+
+    Stops current & starts new measurement/conversion
+
+    NOTE:
+    - forcing CS low immediately stops any conversion process, force CS high
+      to initiate a new measurement process
+    - waits for power-up deadline if beginNoWait() was called recently
+    - micros() is captured right after CS rising edge & jitter against
+      nominal period is updated
+    - conversion started by update() is cancelled, so blocking reads
+      between update() calls never leave it a stale frame, update() marks
+      its own conversion right after this call
+*/
+/**************************************************************************/
+void MAX31855::startConversion(void)
+{
+  uint32_t startMicros;
+  uint32_t jitter;
+
+  waitPowerUp();
+
+  digitalWrite(_cs, LOW);                                          //stop  measurement/conversion
+  delayMicroseconds(1);                                            //pulse fall time > 100nS
+  digitalWrite(_cs, HIGH);                                         //start measurement/conversion
+
+  startMicros = micros();
+
+  if (_nominalPeriod != 0 && _sampleMicros != 0)
+  {
+    jitter = startMicros - _sampleMicros;                          //actual period
+    jitter = (jitter > _nominalPeriod) ? (jitter - _nominalPeriod) : (_nominalPeriod - jitter);
+
+    if (_jitterSum > (UINT32_MAX - jitter))                        //restart mean before overflow, max is kept
+    {
+      _jitterSum   = 0;
+      _jitterCount = 0;
+    }
+
+    if (jitter > _jitterMax) _jitterMax = jitter;
+
+    _jitterSum += jitter;
+    _jitterCount++;
+  }
+
+  _sampleMicros = startMicros;
+  _converting   = false;                                           //previous conversion is stopped by CS low
+}
+
+/**************************************************************************/
+/*
+    waitConversion()
+
+    Waits until measurement/conversion is completed
+
+    NOTE:
+    - see setLowPower() for low power wait details
+*/
+/**************************************************************************/
+void MAX31855::waitConversion(void)
+{
+  if (_lowPower == true)
+  {
+    #if defined(__AVR__)
+    uint32_t startTime = millis();
+
+    set_sleep_mode(SLEEP_MODE_IDLE);
+
+    while ((millis() - startTime) < _conversionTime) sleep_mode(); //any interrupt wakes up mcu, timer0 overflow every ~1msec
+
+    return;
+    #elif defined(ESP32)
+    esp_err_t status;
+
+    esp_sleep_enable_timer_wakeup((uint64_t)_conversionTime * 1000); //in microseconds
+
+    status = esp_light_sleep_start();
+
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);       //don't leave timer armed for user's deep/light sleep
+
+    if (status == ESP_OK) return;                                  //fall back to delay() if light sleep is rejected
+    #elif defined(ESP8266)
+    if (wifi_get_opmode() == NULL_MODE)                            //forced light sleep is possible only with Wi-Fi off
+    {
+      wifi_fpm_set_sleep_type(LIGHT_SLEEP_T);
+      wifi_fpm_open();
+
+      if (wifi_fpm_do_sleep((uint32_t)_conversionTime * 1000) == 0) //in microseconds, RTC timer wakeup
+      {
+        delay(_conversionTime + 1);                                //SDK puts cpu to sleep inside delay()
+        wifi_fpm_close();
+
+        return;
+      }
+
+      wifi_fpm_close();                                            //fall back to delay() if light sleep is rejected
+    }
+    #endif
+  }
+
+  delay(_conversionTime);
+}
+
+/**************************************************************************/
+/*
+    readFrame()
+
+    Reads 32-bit frame from MAX31855 via hardware SPI
+
+    NOTE:
+    - max SPI clock speed for MAX31855 is 5MHz
+    - in SPI_MODE0 data available shortly after the rising edge of SCK
+    - read of the cold-junction compensated thermocouple temperature requires
+      14 clock cycles
+    - read of the cold-junction compensated thermocouple temperature & reference
+      junction temperatures requires 32 clock cycles
+    - set CS low to enable the serial interface & force to output the first bit on the SO pin,
+      apply 14/32 clock signals at SCK to read the results at SO on the falling edge of the SCK
+    - bit D31 is the thermocouple temperature sign bit "+" is high & "-" is low,
+      if T+ & T- pins are unconnected it goes low
+    - bits D30..D18 contain the converted temperature in the order of MSB to LSB,
+      if T+ & T- pins are unconnected they go high
+    - bit D17 is low to provide a device ID for the MAX31855
+    - bit D16 is normally low & goes high if thermocouple is open, shorted to GND or VCC
+    - bit D15 is cold-junction temperature sign bit "+" is high & "-" is low
+    - bits D14..D4 contain cold-junction temperature in the order of MSB to LSB
+    - bit D3 is is low to provide a device ID for the MAX31855
+    - bit D2 is normally low & goes high to indicate a hermocouple short to VCC
+    - bit D1 is normally low & goes high to indicate a thermocouple short to GND
+    - bit D0 is normally low & goes high to indicate a thermocouple open circuit
+
+    - 8-bit  16MHz  AVR  one clock cycle is 62.5nS
+    - 32-bit 80MHz/180 ESP8266 one clock cycle is 12.5nS/5.5nS
+    - 32-bit 160MHz/250MHz ESP32 one clock cycle is 6.25nS/4nS
+    - 32-bit 72MHz STM32 one clock cycle is 13.9nS
+    - arduino 8-bit AVR maximum SPI master clock speed is mcu speed/2,
+      for 5v-16MHz/ProMini speed is 16000000/2=8MHz 
+    - arduino ESP8266 maximum SPI master clock speed is 80000000=80MHz
+    - arduino STM32 maximum SPI master clock speed is mcu speed/2,
+      for STM32F103C8 speed is 72000000/2=36MHz
+*/
+/**************************************************************************/
+int32_t MAX31855::readFrame(void)
+{
+  int32_t rawData = 0;
 
-  SPI.beginTransaction(SPISettings(5000000, MSBFIRST, SPI_MODE0)); //up to 5MHz, read MSB first, SPI mode 0, see note
+  ((SPIClass *)_spi)->beginTransaction(SPISettings(_spiClock, MSBFIRST, SPI_MODE0)); //up to 5MHz, read MSB first, SPI mode 0, see note
 
   digitalWrite(_cs, LOW);                                          //set software CS low to enable SPI interface for MAX31855
 
   for (uint8_t i = 0; i < 2; i++)                                  //read 32-bits via hardware SPI, in order MSB->LSB (D31..D0 bit)
   {
-    rawData = (rawData << 16) | SPI.transfer16(0x0000);            //chip has read only SPI & MOSI not connected, so it doesn't metter what to send
+    rawData = (rawData << 16) | ((SPIClass *)_spi)->transfer16(0x0000); //chip has read only SPI & MOSI not connected, so it doesn't metter what to send
   }
 
   digitalWrite(_cs, HIGH);                                         //disables SPI interface for MAX31855, but it will initiate measurement/conversion
 
-  SPI.endTransaction();                                            //de-asserting hardware CS & free hw SPI for other slaves
+  ((SPIClass *)_spi)->endTransaction();                            //de-asserting hardware CS & free hw SPI for other slaves
 
   return rawData;
 }
@@ -61,6 +61,10 @@
 #include <avr/pgmspace.h>                                 //for Arduino STM32 PROGMEM support
 #endif
 
+#if defined(__AVR__) || defined(ESP8266) || defined(ESP32) || defined(_VARIANT_ARDUINO_STM32_) || defined (STM32)
+#define MAX31855_EEPROM_SUPPORT                           //EEPROM or flash emulated EEPROM is available
+#endif
+
 #ifndef  MAX31855_SOFT_SPI                 //enable upload hw driver spi.h
 #include <SPI.h>
 #endif
@@ -68,13 +72,22 @@
 
 #define MAX31855_CONVERSION_POWER_UP_TIME   200    //in milliseconds
 #define MAX31855_CONVERSION_TIME            100    //in milliseconds, 9..10Hz sampling rate 
+#define MAX31855_CONVERSION_TIME_MIN        40     //in milliseconds, shortest wait checked by measureConversionTime()
+#define MAX31855_CONVERSION_TIME_STEP       5      //in milliseconds, measureConversionTime() step
+#define MAX31855_CONVERSION_TIME_MARGIN     10     //in milliseconds, safety margin added to measured conversion time
+#define MAX31855_SPI_CLOCK                  5000000UL //in Hz, chip maximum SPI clock
+#define MAX31855_SPI_CLOCK_STEPS            6      //tuneSpiClock() halves clock, 5MHz..156kHz
 #define MAX31855_THERMOCOUPLE_RESOLUTION    0.25   //in °C per dac step
 #define MAX31855_COLD_JUNCTION_RESOLUTION   0.0625 //in °C per dac step
 
+#define MAX31855_GAIN_UNITY                 32768  //calibration gain 1.0 in Q15 format
+#define MAX31855_CALIBRATION_SIZE           5      //calibration size in EEPROM, offset + gain + crc8
+
 
 #define MAX31855_ID                         31855
 #define MAX31855_FORCE_READ_DATA            7      //force to read the data, 7 is unique because d2d1d0 can't be all high at the same time
 #define MAX31855_ERROR                      2000   //returned value if any error happends
+#define MAX31855_ERROR_CODE                 32767  //returned integer temperature if any error happends, out of 14-bit range
 
 #define MAX31855_THERMOCOUPLE_OK            0
 #define MAX31855_THERMOCOUPLE_SHORT_TO_VCC  1
@@ -83,22 +96,117 @@
 #define MAX31855_THERMOCOUPLE_UNKNOWN       4
 #define MAX31855_THERMOCOUPLE_READ_FAIL     5
 
+#define MAX31855_ALARM_OFF                  0
+#define MAX31855_ALARM_HIGH                 1
+#define MAX31855_ALARM_LOW                  2
+#define MAX31855_ALARM_FAULT                3      //thermocouple open/shorted or read fail
+
+#if defined(__AVR__)
+typedef volatile uint8_t  MAX31855_PortReg;              //port register for direct pin access
+typedef uint8_t           MAX31855_PortMask;
+#else
+typedef volatile uint32_t MAX31855_PortReg;
+typedef uint32_t          MAX31855_PortMask;
+#endif
+
 class MAX31855
 {
   public:
    MAX31855(uint8_t cs);
+#ifndef  MAX31855_SOFT_SPI
+   MAX31855(uint8_t cs, SPIClass &spi);
+#endif
 
            void     begin(void);
+   virtual void     beginNoWait(void);
+           bool     isReady(void);
            uint8_t  detectThermocouple(int32_t rawValue = MAX31855_FORCE_READ_DATA);
            uint16_t getChipID(int32_t rawValue = MAX31855_FORCE_READ_DATA);
            float    getTemperature(int32_t rawValue = MAX31855_FORCE_READ_DATA);
            float    getColdJunctionTemperature(int32_t rawValue = MAX31855_FORCE_READ_DATA);
+           int16_t  getTemperatureCode(int32_t rawValue = MAX31855_FORCE_READ_DATA);
+           int16_t  getColdJunctionCode(int32_t rawValue = MAX31855_FORCE_READ_DATA);
    virtual int32_t  readRawData(void);
+           void     setLowPower(bool enable);
+           void     setConversionTime(uint8_t time);
+           uint8_t  getConversionTime(void);
+           uint8_t  measureConversionTime(uint8_t trials = 4);
+           void     setSpiClock(uint32_t clock);
+           uint32_t getSpiClock(void);
+           uint32_t tuneSpiClock(uint8_t trials = 8);
+           bool     setCalibration(int16_t offset, uint16_t gain = MAX31855_GAIN_UNITY);
+
+           void     setAlarm(float high, float low, float hysteresis = 0);
+           uint8_t  checkAlarm(int32_t rawValue);
+           uint8_t  getAlarm(void);
+
+           uint32_t getSampleTime(void);
+           uint32_t getSampleMicros(void);
+           uint32_t getReadMicros(void);
+           void     setSamplePeriod(uint32_t period);
+           void     setSamplePeriod(uint32_t period, uint32_t startTime);
+           int32_t  readRawDataPeriodic(void);
+           bool     update(void);
+           int32_t  getRawData(void);
+           uint32_t getSkippedSamples(void);
+           void     setNominalPeriod(uint32_t period);
+           uint32_t getJitterMax(void);
+           uint32_t getJitterMean(void);
+           void     resetJitter(void);
+
+           #ifdef MAX31855_EEPROM_SUPPORT
+           bool     saveCalibration(uint16_t address);
+           bool     loadCalibration(uint16_t address);
+           #endif
+
+   static  void     beginAll(MAX31855 *sensor[], uint8_t quantity);
+   static  void     readRawDataAll(MAX31855 *sensor[], int32_t rawData[], uint8_t quantity);
+   static  void     readRawDataPeriodicAll(MAX31855 *sensor[], int32_t rawData[], uint8_t quantity);
  
   private:
+   int16_t  _offset;
+   uint16_t _gain;
+
+   int16_t  _alarmHigh;                                  //thresholds in calibrated 0.25°C steps
+   int16_t  _alarmLow;
+   int16_t  _alarmHysteresis;
+   int16_t  _alarmHighSet;                               //thresholds in raw 14-bit codes
+   int16_t  _alarmHighClear;
+   int16_t  _alarmLowSet;
+   int16_t  _alarmLowClear;
+   volatile uint8_t _alarmState;
+
+   uint32_t _samplePeriod;                               //in milliseconds
+   uint32_t _sampleSlot;                                 //next conversion start, in milliseconds
+   uint32_t _skippedSamples;
+   bool     _converting;
+   int32_t  _rawData;
+   uint32_t _nominalPeriod;                              //in microseconds
+   uint32_t _jitterMax;
+   uint32_t _jitterSum;
+   uint32_t _jitterCount;
+
+           int16_t  calibrate(int16_t code);
+           int16_t  findCode(int16_t code);
+           void     updateAlarm(void);
+           int32_t  getSlotTime(void);
+   static  uint8_t  crc8(const uint8_t *data, uint8_t length);
 
   protected:
-   uint8_t _cs;
+   uint8_t  _cs;
+   void    *_spi;                                        //hw SPI bus, SPIClass is known only to MAX31855.cpp
+   uint32_t _spiClock;                                   //in Hz
+   bool     _lowPower;
+   uint8_t  _conversionTime;                             //in milliseconds
+   bool     _powerUp;
+   uint32_t _powerUpTime;
+   uint32_t _sampleMicros;                               //CS rising edge, conversion start
+   uint32_t _readMicros;                                 //frame readout
+
+           void     waitPowerUp(void);
+           void     startConversion(void);
+           void     waitConversion(void);
+   virtual int32_t  readFrame(void);
 };
 
 #endif
@@ -0,0 +1,127 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. Deadband change-notification filter.
+
+   - sample is emitted only if it moves more than deadband, status is changed
+     or heartbeat interval is expired
+   - works with integer 0.25°C codes, see MAX31855::getTemperatureCode()
+   - serial/radio traffic scales with information rather than sample rate
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX31855deadband.h>
+
+
+/**************************************************************************/
+/*
+    MAX31855deadband()
+
+    Constructor for deadband filter
+
+    NOTE:
+    - channel is passed to callback to identify the sensor
+*/
+/**************************************************************************/
+MAX31855deadband::MAX31855deadband(uint8_t channel)
+{
+  _channel   = channel;
+  _emitted   = false;
+  _deadband  = 0;
+  _code      = MAX31855_ERROR_CODE;
+  _status    = MAX31855_THERMOCOUPLE_UNKNOWN;
+  _heartbeat = 0;
+  _emitTime  = 0;
+  _callback  = NULL;
+}
+
+/**************************************************************************/
+/*
+    begin()
+
+    Sets deadband in °C, heartbeat in milliseconds & callback
+
+    NOTE:
+    - deadband is converted once to 0.25°C steps, 0.25°C is 1 step
+    - heartbeat 0 disables periodic emit
+    - callback is called for every emitted sample, NULL disables it
+*/
+/**************************************************************************/
+void MAX31855deadband::begin(float deadband, uint32_t heartbeat, MAX31855_Callback callback)
+{
+  _deadband  = abs(deadband) / MAX31855_THERMOCOUPLE_RESOLUTION + 0.5;
+  _heartbeat = heartbeat;
+  _callback  = callback;
+  _emitted   = false;                                  //next sample is always emitted
+}
+
+/**************************************************************************/
+/*
+    update()
+
+    Checks new sample & emits it if it has new information
+
+    NOTE:
+    - code in 0.25°C steps, see MAX31855::getTemperatureCode()
+    - status see MAX31855::detectThermocouple(), if status is not OK
+      code is ignored
+    - MAX31855_ERROR_CODE is a fault whatever status says, it is
+      reported as MAX31855_THERMOCOUPLE_READ_FAIL
+    - returns true if sample is emitted
+*/
+/**************************************************************************/
+bool MAX31855deadband::update(int16_t code, uint8_t status)
+{
+  uint32_t currentTime = millis();
+  bool     emit        = false;
+
+  if (code == MAX31855_ERROR_CODE && status == MAX31855_THERMOCOUPLE_OK) status = MAX31855_THERMOCOUPLE_READ_FAIL;
+
+  if      (_emitted == false)                                                    emit = true;
+  else if (status != _status)                                                    emit = true;
+  else if (status == MAX31855_THERMOCOUPLE_OK && abs(code - _code) > _deadband)  emit = true;
+  else if (_heartbeat != 0 && (currentTime - _emitTime) >= _heartbeat)           emit = true;
+
+  if (emit == false) return false;
+
+  if (status != MAX31855_THERMOCOUPLE_OK) code = MAX31855_ERROR_CODE;
+
+  _emitted  = true;
+  _code     = code;
+  _status   = status;
+  _emitTime = currentTime;
+
+  if (_callback != NULL) _callback(_channel, code, status);
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    getCode()
+
+    Returns last emitted code, in 0.25°C steps
+*/
+/**************************************************************************/
+int16_t MAX31855deadband::getCode(void)
+{
+  return _code;
+}
+
+/**************************************************************************/
+/*
+    getStatus()
+
+    Returns last emitted status
+*/
+/**************************************************************************/
+uint8_t MAX31855deadband::getStatus(void)
+{
+  return _status;
+}
@@ -0,0 +1,48 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. Deadband change-notification filter.
+
+   - sample is emitted only if it moves more than deadband, status is changed
+     or heartbeat interval is expired
+   - works with integer 0.25°C codes, see MAX31855::getTemperatureCode()
+   - serial/radio traffic scales with information rather than sample rate
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX31855deadband_h
+#define MAX31855deadband_h
+
+#include <MAX31855.h>
+
+typedef void (*MAX31855_Callback)(uint8_t channel, int16_t code, uint8_t status); //code in 0.25°C steps, status see detectThermocouple()
+
+
+class MAX31855deadband
+{
+  public:
+   MAX31855deadband(uint8_t channel = 0);
+
+   void     begin(float deadband, uint32_t heartbeat = 0, MAX31855_Callback callback = NULL);
+   bool     update(int16_t code, uint8_t status = MAX31855_THERMOCOUPLE_OK);
+   int16_t  getCode(void);
+   uint8_t  getStatus(void);
+ 
+  private:
+   uint8_t           _channel;
+   bool              _emitted;
+   int16_t           _deadband;
+   int16_t           _code;
+   uint8_t           _status;
+   uint32_t          _heartbeat;
+   uint32_t          _emitTime;
+   MAX31855_Callback _callback;
+};
+
+#endif
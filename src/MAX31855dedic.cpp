@@ -0,0 +1,265 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation conneted to ESP32-S2/S3/C3 dedicated GPIO bundle
+   with maximum sampling rate ~9..10Hz.
+
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+     Optimal performance of cold junction compensation happends when the thermocouple cold junction
+     & the MAX31855 are at the same temperature. Avoid placing heat-generating devices or components
+     near the converter because this may produce an errors.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   Board:                                     Level
+   ESP32-S2, ESP32-S3, ESP32-C3.............  3v
+
+   Frameworks & Libraries:
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX31855dedic.h>
+
+#if defined(MAX31855_DEDIC_GPIO)
+
+#include <hal/dedic_gpio_cpu_ll.h>
+
+#ifndef F_CPU
+#define F_CPU 240000000UL
+#endif
+
+#define MAX31855_DEDIC_WAIT_LOOPS (F_CPU / 10000000UL)  //qnt. of loops for 100nS, every loop takes >= 1 cpu cycle
+
+#define MAX31855_DEDIC_WAIT()     for (uint8_t n = MAX31855_DEDIC_WAIT_LOOPS; n > 0; n--) __asm__ __volatile__ ("nop")
+
+
+/**************************************************************************/
+/*
+    MAX31855dedic()
+
+    Constructor for dedicated GPIO read only SPI
+
+    NOTE:
+    cs  - chip select, set CS low to enable the serial interface
+    so  - serial data output
+    sck - serial clock input
+*/
+/**************************************************************************/
+MAX31855dedic::MAX31855dedic(uint8_t cs, uint8_t so, uint8_t sck) : MAX31855(cs)
+{
+  _sck       = sck;
+  _so[0]     = so;
+  _quantity  = 1;
+  _sckBundle = NULL;
+  _soBundle  = NULL;
+  _sckMask   = 0;
+  _soOffset  = 0;
+}
+
+/**************************************************************************/
+/*
+    MAX31855dedic()
+
+    Constructor for dedicated GPIO read only SPI for sensors sharing one
+    CS & SCK, each sensor has own SO line
+
+    NOTE:
+    cs       - chip select, common for all sensors
+    sck      - serial clock input, common for all sensors
+    so       - serial data outputs, one per sensor
+    quantity - qnt. of sensors, up to 8
+*/
+/**************************************************************************/
+MAX31855dedic::MAX31855dedic(uint8_t cs, uint8_t sck, const uint8_t so[], uint8_t quantity) : MAX31855(cs)
+{
+  if (quantity > MAX31855_PARALLEL_MAX) quantity = MAX31855_PARALLEL_MAX;
+  if (quantity == 0)                    quantity = 1;
+
+  for (uint8_t i = 0; i < quantity; i++) _so[i] = so[i];
+
+  _sck       = sck;
+  _quantity  = quantity;
+  _sckBundle = NULL;
+  _soBundle  = NULL;
+  _sckMask   = 0;
+  _soOffset  = 0;
+}
+
+/**************************************************************************/
+/*
+    beginNoWait()
+
+    Initializes & configures dedicated GPIO bundles without waiting for
+    power-up
+
+    NOTE:
+    - power-up deadline is stored & honored by the first read
+    - pinMode() routes pin back to GPIO matrix, so it is called before
+      pins are connected to dedicated GPIO channels
+    - CS stays regular GPIO, it is used by startConversion() & toggles
+      only twice per frame
+    - if there are no free dedicated channels, read returns 0 &
+      detectThermocouple() returns MAX31855_THERMOCOUPLE_READ_FAIL
+*/
+/**************************************************************************/
+void MAX31855dedic::beginNoWait(void)
+{
+  int                        sckPin = _sck;
+  int                        soPin[MAX31855_PARALLEL_MAX];
+  dedic_gpio_bundle_config_t config;
+
+  pinMode(_cs, OUTPUT);
+  digitalWrite(_cs, HIGH);                  //disables SPI interface for MAX31855, but it will initiate measurement/conversion
+
+  pinMode(_sck, OUTPUT);
+  digitalWrite(_sck, LOW);
+
+  for (uint8_t i = 0; i < _quantity; i++)
+  {
+    pinMode(_so[i], INPUT);
+
+    soPin[i] = _so[i];
+  }
+
+  /* SCK bundle, one output channel */
+  memset(&config, 0, sizeof(config));
+
+  config.gpio_array    = &sckPin;
+  config.array_size    = 1;
+  config.flags.out_en  = 1;
+
+  if (dedic_gpio_new_bundle(&config, &_sckBundle) != ESP_OK) _sckBundle = NULL;
+
+  /* SO bundle, one input channel per sensor */
+  memset(&config, 0, sizeof(config));
+
+  config.gpio_array    = soPin;
+  config.array_size    = _quantity;
+  config.flags.in_en   = 1;
+
+  if (dedic_gpio_new_bundle(&config, &_soBundle) != ESP_OK) _soBundle = NULL;
+
+  if (_sckBundle != NULL) dedic_gpio_get_out_mask(_sckBundle, &_sckMask);
+  if (_soBundle  != NULL) dedic_gpio_get_in_offset(_soBundle, &_soOffset);
+
+  _powerUpTime = millis();
+  _powerUp     = true;
+}
+
+/**************************************************************************/
+/*
+    readRawDataParallel()
+
+    Reads raw data from all sensors sharing CS & SCK
+
+    NOTE:
+    - all sensors convert at the same time & 32 clocks read all of them
+    - rawData[] must have getQuantity() elements, 0 is read fail
+    - see MAX31855::readFrame() for bits description
+*/
+/**************************************************************************/
+void MAX31855dedic::readRawDataParallel(int32_t rawData[])
+{
+  startConversion();
+  waitConversion();
+
+  readFrames(rawData);
+  _readMicros = micros();
+}
+
+/**************************************************************************/
+/*
+    getQuantity()
+
+    Returns qnt. of sensors sharing CS & SCK
+*/
+/**************************************************************************/
+uint8_t MAX31855dedic::getQuantity(void)
+{
+  return _quantity;
+}
+
+/**************************************************************************/
+/*
+    readFrames()
+
+    Reads 32-bit frames from all MAX31855 via dedicated GPIO
+
+    NOTE:
+    - SCK high & low time must be > 100nS & CS fall to SCK rise > 100nS,
+      every wait loop takes >= 1 cpu cycle, so SCK is <= 5MHz
+    - SPI_MODE0 -> data available shortly after the rising edge of SCK
+    - all SO channels are sampled by one cpu instruction per clock &
+      de-interleaved after CS high, so the clock loop stays short
+    - interrupt during transfer only stretches SCK, SPI is static & frame
+      stays valid, so interrupts are not disabled
+*/
+/**************************************************************************/
+bool MAX31855dedic::readFrames(int32_t rawData[])
+{
+  uint8_t sample[32];
+
+  for (uint8_t i = 0; i < _quantity; i++) rawData[i] = 0;
+
+  if (_sckBundle == NULL || _soBundle == NULL) return false;
+
+  digitalWrite(_cs, LOW);                                          //set CS low to enable SPI interface for all MAX31855
+  MAX31855_DEDIC_WAIT();
+
+  /* emulate SPI_MODE0 */
+  for (uint8_t bit = 0; bit < 32; bit++)                           //read 32-bits, in order MSB->LSB (D31..D0 bit)
+  {
+    dedic_gpio_cpu_ll_write_mask(_sckMask, _sckMask);              //data available shortly after rising edge of SCK
+    MAX31855_DEDIC_WAIT();
+
+    sample[bit] = dedic_gpio_cpu_ll_read_in() >> _soOffset;        //all SO lines at once
+
+    dedic_gpio_cpu_ll_write_mask(_sckMask, 0);                     //data is clocked out on falling edge of SCK
+    MAX31855_DEDIC_WAIT();
+  }
+
+  digitalWrite(_cs, HIGH);                                         //disables SPI interface for all MAX31855, but it will initiate measurement/conversion
+
+  for (uint8_t bit = 0; bit < 32; bit++)                           //de-interleave, bit i of sample is SO line i
+  {
+    for (uint8_t i = 0; i < _quantity; i++)
+    {
+      rawData[i] = (rawData[i] << 1) | ((sample[bit] >> i) & 0x01);
+    }
+  }
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    readFrame()
+
+    Reads 32-bit frame from the first MAX31855 via dedicated GPIO
+
+    NOTE:
+    - other sensors sharing CS & SCK are clocked too, their frames are
+      dropped, use readRawDataParallel() to get them
+*/
+/**************************************************************************/
+int32_t MAX31855dedic::readFrame(void)
+{
+  int32_t rawData[MAX31855_PARALLEL_MAX];
+
+  readFrames(rawData);
+
+  return rawData[0];
+}
+
+#endif
@@ -0,0 +1,85 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation conneted to ESP32-S2/S3/C3 dedicated GPIO bundle
+   with maximum sampling rate ~9..10Hz.
+
+   - dedicated GPIO is accessed by cpu instructions in one cycle & bypasses slow
+     digitalWrite()/digitalRead(), SCK runs at 5MHz chip maximum
+   - up to 8 sensors share one CS & SCK & have own SO lines, all SO lines are
+     sampled by one instruction per clock, 8 frames take ~7usec or ~1usec per sensor
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+     Optimal performance of cold junction compensation happends when the thermocouple cold junction
+     & the MAX31855 are at the same temperature. Avoid placing heat-generating devices or components
+     near the converter because this may produce an errors.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   Board:                                     Level
+   ESP32-S2, ESP32-S3, ESP32-C3.............  3v
+
+                                              *any GPIO can be used for CS, SCK & SO
+
+   Frameworks & Libraries:
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX31855dedic_h
+#define MAX31855dedic_h
+
+#define MAX31855_SOFT_SPI //disable upload hw driver spi.h
+
+#include <MAX31855.h>
+
+#if defined(CONFIG_IDF_TARGET_ESP32S2) || defined(CONFIG_IDF_TARGET_ESP32S3) || defined(CONFIG_IDF_TARGET_ESP32C3)
+#define MAX31855_DEDIC_GPIO                                //compile only for mcu with dedicated GPIO
+#endif
+
+#if defined(MAX31855_DEDIC_GPIO)
+
+#include <driver/dedic_gpio.h>
+
+#ifndef MAX31855_PARALLEL_MAX
+#define MAX31855_PARALLEL_MAX 8 //max qnt. of SO lines read in parallel, dedicated GPIO has 8 input channels
+#endif
+
+
+class MAX31855dedic : public MAX31855
+{
+  public:
+   MAX31855dedic(uint8_t cs, uint8_t so, uint8_t sck);
+   MAX31855dedic(uint8_t cs, uint8_t sck, const uint8_t so[], uint8_t quantity);
+
+   void     beginNoWait(void);
+   void     readRawDataParallel(int32_t rawData[]);
+   uint8_t  getQuantity(void);
+ 
+  private:
+   uint8_t                    _sck;
+   uint8_t                    _so[MAX31855_PARALLEL_MAX];
+   uint8_t                    _quantity;
+   dedic_gpio_bundle_handle_t _sckBundle;
+   dedic_gpio_bundle_handle_t _soBundle;
+   uint32_t                   _sckMask;             //SCK channel of cpu dedicated outputs
+   uint32_t                   _soOffset;            //the first SO channel of cpu dedicated inputs
+
+   bool     readFrames(int32_t rawData[]);
+
+  protected:
+   int32_t  readFrame(void);
+};
+
+#endif
+
+#endif
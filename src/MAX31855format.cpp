@@ -0,0 +1,146 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. Fixed point temperature formatter.
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX31855format.h>
+
+static const char     MAX31855_DIGIT_PAIR[201] PROGMEM = "00010203040506070809"
+                                                         "10111213141516171819"
+                                                         "20212223242526272829"
+                                                         "30313233343536373839"
+                                                         "40414243444546474849"
+                                                         "50515253545556575859"
+                                                         "60616263646566676869"
+                                                         "70717273747576777879"
+                                                         "80818283848586878889"
+                                                         "90919293949596979899"; //100 pairs & null terminator
+
+static const uint16_t MAX31855_POWER_OF_10[5] PROGMEM  = {1, 10, 100, 1000, 10000};
+
+
+/**************************************************************************/
+/*
+    temperature()
+
+    Renders thermocouple code into buffer, C
+
+    Return:
+    - qnt. of chars without null terminator
+
+    NOTE:
+    - code is in 0.25°C steps, see MAX31855::getTemperatureCode()
+    - decimals 0..2, 2 is exact, less is rounded half away from zero
+    - MAX31855_ERROR_CODE is rendered as "error"
+    - buffer must be MAX31855_FORMAT_SIZE chars
+*/
+/**************************************************************************/
+uint8_t MAX31855format::temperature(char buffer[], int16_t code, uint8_t decimals)
+{
+  if (code == MAX31855_ERROR_CODE)
+  {
+    strcpy_P(buffer, PSTR("error"));
+
+    return 5;
+  }
+
+  return fixed(buffer, (int32_t)code * 25, 2, decimals);   //0.25°C is 25/100°C
+}
+
+/**************************************************************************/
+/*
+    coldJunction()
+
+    Renders cold junction code into buffer, C
+
+    Return:
+    - qnt. of chars without null terminator
+
+    NOTE:
+    - code is in 0.0625°C steps, see MAX31855::getColdJunctionCode()
+    - decimals 0..4, 4 is exact, less is rounded half away from zero
+    - MAX31855_ERROR_CODE is rendered as "error"
+    - buffer must be MAX31855_FORMAT_SIZE chars
+*/
+/**************************************************************************/
+uint8_t MAX31855format::coldJunction(char buffer[], int16_t code, uint8_t decimals)
+{
+  if (code == MAX31855_ERROR_CODE)
+  {
+    strcpy_P(buffer, PSTR("error"));
+
+    return 5;
+  }
+
+  return fixed(buffer, (int32_t)code * 625, 4, decimals);  //0.0625°C is 625/10000°C
+}
+
+/**************************************************************************/
+/*
+    fixed()
+
+    Renders fixed point value into buffer
+
+    Return:
+    - qnt. of chars without null terminator
+
+    NOTE:
+    - private, only int16_t codes * 25 or * 625 are passed, so the
+      longest result is "-2048.0000" & fits MAX31855_FORMAT_SIZE
+    - value is in 10^-scale units, scale 0..4
+    - decimals is qnt. of digits after the point, trailing zeros are
+      kept, so columns of many channels stay aligned
+    - digits are rendered from the end, two per division by 100
+    - "-0.0" is never rendered, rounded zero has no sign
+*/
+/**************************************************************************/
+uint8_t MAX31855format::fixed(char buffer[], int32_t value, uint8_t scale, uint8_t decimals)
+{
+  char     digit[10];                                              //uint32_t has 10 digits max
+  uint8_t  count    = 0;
+  uint8_t  length   = 0;
+  uint8_t  pair;
+  uint16_t divider;
+  uint32_t absValue = (value < 0) ? -(uint32_t)value : value;
+
+  if (scale > 4)        scale    = 4;
+  if (decimals > scale) decimals = scale;
+
+  divider  = pgm_read_word(&MAX31855_POWER_OF_10[scale - decimals]);
+  absValue = (absValue + (divider / 2)) / divider;                 //round half away from zero
+
+  if (value < 0 && absValue != 0) buffer[length++] = '-';          //rounded zero has no sign
+
+  while (absValue >= 100)
+  {
+    pair      = absValue % 100;
+    absValue /= 100;
+
+    digit[9 - count++] = pgm_read_byte(&MAX31855_DIGIT_PAIR[pair * 2 + 1]);
+    digit[9 - count++] = pgm_read_byte(&MAX31855_DIGIT_PAIR[pair * 2]);
+  }
+
+  digit[9 - count++] = pgm_read_byte(&MAX31855_DIGIT_PAIR[absValue * 2 + 1]);
+  if (absValue >= 10) digit[9 - count++] = pgm_read_byte(&MAX31855_DIGIT_PAIR[absValue * 2]);
+
+  while (count <= decimals) digit[9 - count++] = '0';              //leading zeros, at least "0.xx"
+
+  for (uint8_t i = count; i > 0; i--)
+  {
+    if (i == decimals) buffer[length++] = '.';
+
+    buffer[length++] = digit[10 - i];
+  }
+
+  buffer[length] = '\0';
+
+  return length;
+}
@@ -0,0 +1,38 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. Fixed point temperature formatter.
+
+   - renders 0.25°C thermocouple & 0.0625°C cold junction codes into caller buffer,
+     see MAX31855::getTemperatureCode() & MAX31855::getColdJunctionCode()
+   - two digits per step from "00".."99" table in flash, fixed qnt. of decimals,
+     no floating point, no heap, no String
+   - ~10 times faster than Print::print(float, digits) on AVR
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX31855format_h
+#define MAX31855format_h
+
+#include <MAX31855.h>
+
+#define MAX31855_FORMAT_SIZE 12 //buffer size, "-2048.0000" & null terminator fit
+
+
+class MAX31855format
+{
+  public:
+   static uint8_t temperature(char buffer[], int16_t code, uint8_t decimals = 2);
+   static uint8_t coldJunction(char buffer[], int16_t code, uint8_t decimals = 2);
+
+  private:
+   static uint8_t fixed(char buffer[], int32_t value, uint8_t scale, uint8_t decimals);
+};
+
+#endif
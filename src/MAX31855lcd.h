@@ -0,0 +1,244 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. Incremental character LCD renderer.
+
+   - text is drawn into RAM frame, refresh() compares it with shadow copy of the lcd
+     & sends only changed cells, unchanged temperature costs no bus time
+   - cursor is moved only if changed cells are not next to each other, lcd
+     increments address after every char by itself
+   - 20x4 lcd over 100kHz PCF8574 I2C takes ~20msec to rewrite, one changed
+     digit takes ~1msec
+   - works with any lcd driver with setCursor(column, row) & write(char),
+     for example LiquidCrystal, LiquidCrystal_I2C
+   - template is header only, frame & shadow take 2 * COLUMNS * ROWS bytes of RAM
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX31855lcd_h
+#define MAX31855lcd_h
+
+#include <MAX31855format.h>
+
+#define MAX31855_LCD_SPACE     0x20 //space symbol from lcd ROM
+#define MAX31855_LCD_FULL_CELL 0xFF //filled cell symbol from lcd ROM, see p.9 of GDM2004D datasheet
+
+
+template <class LCD, uint8_t COLUMNS, uint8_t ROWS>
+class MAX31855lcd
+{
+  public:
+   /**************************************************************************/
+   /*
+       MAX31855lcd()
+
+       Constructor
+
+       NOTE:
+       - lcd must be started before the first refresh()
+   */
+   /**************************************************************************/
+   MAX31855lcd(LCD &lcd) : _lcd(lcd)
+   {
+     clear();
+     invalidate();
+   }
+
+   /**************************************************************************/
+   /*
+       clear()
+
+       Fills frame with spaces
+
+       NOTE:
+       - lcd is not cleared, changed cells are sent by refresh()
+   */
+   /**************************************************************************/
+   void clear(void)
+   {
+     memset(_frame, MAX31855_LCD_SPACE, sizeof(_frame));
+   }
+
+   /**************************************************************************/
+   /*
+       invalidate()
+
+       Forgets shadow copy, the next refresh() rewrites all cells
+
+       NOTE:
+       - call after lcd.clear(), lcd.begin() or any direct lcd print
+   */
+   /**************************************************************************/
+   void invalidate(void)
+   {
+     for (uint8_t row = 0; row < ROWS; row++)
+     {
+       for (uint8_t column = 0; column < COLUMNS; column++) _shadow[row][column] = ~_frame[row][column];
+     }
+   }
+
+   /**************************************************************************/
+   /*
+       write()
+
+       Draws one char into frame
+
+       NOTE:
+       - cells outside lcd are ignored
+   */
+   /**************************************************************************/
+   void write(uint8_t column, uint8_t row, uint8_t symbol)
+   {
+     if (column < COLUMNS && row < ROWS) _frame[row][column] = symbol;
+   }
+
+   /**************************************************************************/
+   /*
+       print()
+
+       Draws text into frame, left aligned & padded with spaces to width
+
+       Return:
+       - qnt. of drawn chars without padding
+
+       NOTE:
+       - text longer than width is cut, width 0 is text length
+   */
+   /**************************************************************************/
+   uint8_t print(uint8_t column, uint8_t row, const char text[], uint8_t width = 0)
+   {
+     uint8_t length = 0;
+
+     while (text[length] != '\0' && (width == 0 || length < width))
+     {
+       write(column + length, row, text[length]);
+       length++;
+     }
+
+     for (uint8_t i = length; i < width; i++) write(column + i, row, MAX31855_LCD_SPACE);
+
+     return length;
+   }
+
+   /**************************************************************************/
+   /*
+       printTemperature()
+
+       Draws thermocouple code into frame, right aligned to width
+
+       NOTE:
+       - code is in 0.25°C steps, see MAX31855::getTemperatureCode()
+       - fixed width & decimals keep unchanged digits in place, so only
+         really changed digits are sent
+   */
+   /**************************************************************************/
+   void printTemperature(uint8_t column, uint8_t row, int16_t code, uint8_t width, uint8_t decimals = 1)
+   {
+     char text[MAX31855_FORMAT_SIZE];
+
+     printRight(column, row, text, MAX31855format::temperature(text, code, decimals), width);
+   }
+
+   /**************************************************************************/
+   /*
+       printColdJunction()
+
+       Draws cold junction code into frame, right aligned to width
+
+       NOTE:
+       - code is in 0.0625°C steps, see MAX31855::getColdJunctionCode()
+   */
+   /**************************************************************************/
+   void printColdJunction(uint8_t column, uint8_t row, int16_t code, uint8_t width, uint8_t decimals = 1)
+   {
+     char text[MAX31855_FORMAT_SIZE];
+
+     printRight(column, row, text, MAX31855format::coldJunction(text, code, decimals), width);
+   }
+
+   /**************************************************************************/
+   /*
+       printBar()
+
+       Draws horizontal bar graph into frame
+
+       NOTE:
+       - value & maxValue are in any same units, for example codes
+       - value <= 0 is empty bar, value >= maxValue is full bar
+   */
+   /**************************************************************************/
+   void printBar(uint8_t column, uint8_t row, uint8_t width, int32_t value, int32_t maxValue)
+   {
+     uint8_t cells = 0;
+
+     if (value >= maxValue) cells = width;
+     else if (value > 0)    cells = (value * width) / maxValue;
+
+     for (uint8_t i = 0; i < width; i++) write(column + i, row, (i < cells) ? MAX31855_LCD_FULL_CELL : MAX31855_LCD_SPACE);
+   }
+
+   /**************************************************************************/
+   /*
+       refresh()
+
+       Sends changed cells to lcd
+
+       Return:
+       - qnt. of sent cells, 0 if frame is not changed & bus was not used
+   */
+   /**************************************************************************/
+   uint8_t refresh(void)
+   {
+     uint8_t sent = 0;
+     bool    cursor;
+
+     for (uint8_t row = 0; row < ROWS; row++)
+     {
+       cursor = false;                                               //rows are not continuous in lcd memory
+
+       for (uint8_t column = 0; column < COLUMNS; column++)
+       {
+         if (_frame[row][column] == _shadow[row][column])
+         {
+           cursor = false;
+           continue;
+         }
+
+         if (cursor == false)
+         {
+           _lcd.setCursor(column, row);
+           cursor = true;
+         }
+
+         _lcd.write(_frame[row][column]);                            //lcd increments address by itself
+
+         _shadow[row][column] = _frame[row][column];
+         sent++;
+       }
+     }
+
+     return sent;
+   }
+
+  private:
+   LCD     &_lcd;
+   uint8_t  _frame[ROWS][COLUMNS];                                   //wanted text
+   uint8_t  _shadow[ROWS][COLUMNS];                                  //text on lcd
+
+   void printRight(uint8_t column, uint8_t row, const char text[], uint8_t length, uint8_t width)
+   {
+     uint8_t padding = (length < width) ? (width - length) : 0;
+
+     for (uint8_t i = 0; i < padding; i++) write(column + i, row, MAX31855_LCD_SPACE);
+
+     print(column + padding, row, text, width - padding);
+   }
+};
+
+#endif
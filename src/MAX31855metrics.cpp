@@ -0,0 +1,231 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. OpenMetrics text exposition.
+
+   - per channel temperatures, fault state, read & fault counters, read latency histogram
+   - rendered directly to any Print stream (Serial, WiFiClient, EthernetClient),
+     no heap, no String, no floating point
+   - serve it over HTTP, for example ESP8266/ESP32 WiFiServer, for Prometheus scraping
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX31855metrics.h>
+
+static const uint16_t MAX31855_LATENCY_BUCKET[MAX31855_METRICS_BUCKETS] PROGMEM = {75, 100, 110, 150, 250}; //upper bounds in milliseconds
+
+
+/**************************************************************************/
+/*
+    MAX31855metrics()
+
+    Constructor for OpenMetrics exposition
+*/
+/**************************************************************************/
+MAX31855metrics::MAX31855metrics(void)
+{
+  memset(_channel, 0, sizeof(_channel));
+}
+
+/**************************************************************************/
+/*
+    update()
+
+    Records new frame of the channel
+
+    NOTE:
+    - call it after readRawData(), readRawDataAll() or update() returned
+      the frame, latency is the sample age when the frame was read,
+      see MAX31855::getReadMicros()
+    - channels >= MAX31855_METRICS_CHANNELS are ignored
+*/
+/**************************************************************************/
+void MAX31855metrics::update(uint8_t channel, MAX31855 &sensor, int32_t rawData)
+{
+  Channel  *metric;
+  uint32_t  latency;
+  uint8_t   bucket = 0;
+
+  if (channel >= MAX31855_METRICS_CHANNELS) return;
+
+  metric = &_channel[channel];
+
+  metric->valid            = true;
+  metric->status           = sensor.detectThermocouple(rawData);
+  metric->code             = sensor.getTemperatureCode(rawData);
+  metric->coldJunctionCode = sensor.getColdJunctionCode(rawData);
+  metric->reads++;
+
+  if (metric->status != MAX31855_THERMOCOUPLE_OK) metric->faults++;
+
+  latency             = sensor.getReadMicros() - sensor.getSampleMicros(); //in microseconds, 100msec wait is ~100.01msec latency
+  metric->latencySum += latency;
+
+  while (bucket < MAX31855_METRICS_BUCKETS && latency > (pgm_read_word(&MAX31855_LATENCY_BUCKET[bucket]) * 1000UL)) bucket++;
+
+  if (bucket < MAX31855_METRICS_BUCKETS) metric->latencyBucket[bucket]++; //latency > last bucket is counted only in +Inf
+}
+
+/**************************************************************************/
+/*
+    print()
+
+    Prints all channels in OpenMetrics text format
+
+    NOTE:
+    - content type is "application/openmetrics-text; version=1.0.0; charset=utf-8"
+    - channels without frames are skipped
+*/
+/**************************************************************************/
+void MAX31855metrics::print(Print &out)
+{
+  uint32_t count;
+  char     text[MAX31855_FORMAT_SIZE];
+
+  printHeader(out, F("max31855_temperature_celsius"), F("gauge"));
+  for (uint8_t i = 0; i < MAX31855_METRICS_CHANNELS; i++)
+  {
+    if (_channel[i].valid == false || _channel[i].code == MAX31855_ERROR_CODE) continue;
+
+    printLabel(out, F("max31855_temperature_celsius"), i);
+    out.write(text, MAX31855format::temperature(text, _channel[i].code, 2));
+    out.print('\n');
+  }
+
+  printHeader(out, F("max31855_cold_junction_celsius"), F("gauge"));
+  for (uint8_t i = 0; i < MAX31855_METRICS_CHANNELS; i++)
+  {
+    if (_channel[i].valid == false || _channel[i].coldJunctionCode == MAX31855_ERROR_CODE) continue;
+
+    printLabel(out, F("max31855_cold_junction_celsius"), i);
+    out.write(text, MAX31855format::coldJunction(text, _channel[i].coldJunctionCode, 4));
+    out.print('\n');
+  }
+
+  printHeader(out, F("max31855_status"), F("gauge"));
+  for (uint8_t i = 0; i < MAX31855_METRICS_CHANNELS; i++)
+  {
+    if (_channel[i].valid == false) continue;
+
+    printLabel(out, F("max31855_status"), i);
+    out.print(_channel[i].status);
+    out.print('\n');
+  }
+
+  printHeader(out, F("max31855_reads"), F("counter"));
+  for (uint8_t i = 0; i < MAX31855_METRICS_CHANNELS; i++)
+  {
+    if (_channel[i].valid == false) continue;
+
+    printLabel(out, F("max31855_reads_total"), i);
+    out.print(_channel[i].reads);
+    out.print('\n');
+  }
+
+  printHeader(out, F("max31855_faults"), F("counter"));
+  for (uint8_t i = 0; i < MAX31855_METRICS_CHANNELS; i++)
+  {
+    if (_channel[i].valid == false) continue;
+
+    printLabel(out, F("max31855_faults_total"), i);
+    out.print(_channel[i].faults);
+    out.print('\n');
+  }
+
+  printHeader(out, F("max31855_read_latency_seconds"), F("histogram"));
+  for (uint8_t i = 0; i < MAX31855_METRICS_CHANNELS; i++)
+  {
+    if (_channel[i].valid == false) continue;
+
+    count = 0;
+
+    for (uint8_t bucket = 0; bucket < MAX31855_METRICS_BUCKETS; bucket++)
+    {
+      count += _channel[i].latencyBucket[bucket];                    //buckets are cumulative
+
+      out.print(F("max31855_read_latency_seconds_bucket{channel=\""));
+      out.print(i);
+      out.print(F("\",le=\""));
+      printFixed(out, pgm_read_word(&MAX31855_LATENCY_BUCKET[bucket]), 1000);
+      out.print(F("\"} "));
+      out.print(count);
+      out.print('\n');
+    }
+
+    out.print(F("max31855_read_latency_seconds_bucket{channel=\""));
+    out.print(i);
+    out.print(F("\",le=\"+Inf\"} "));
+    out.print(_channel[i].reads);
+    out.print('\n');
+
+    printLabel(out, F("max31855_read_latency_seconds_count"), i);
+    out.print(_channel[i].reads);
+    out.print('\n');
+
+    printLabel(out, F("max31855_read_latency_seconds_sum"), i);
+    printFixed(out, _channel[i].latencySum, 1000000);
+    out.print('\n');
+  }
+
+  out.print(F("# EOF\n"));
+}
+
+/**************************************************************************/
+/*
+    printHeader()
+
+    Prints metric family type line
+*/
+/**************************************************************************/
+void MAX31855metrics::printHeader(Print &out, const __FlashStringHelper *name, const __FlashStringHelper *type)
+{
+  out.print(F("# TYPE "));
+  out.print(name);
+  out.print(' ');
+  out.print(type);
+  out.print('\n');
+}
+
+/**************************************************************************/
+/*
+    printLabel()
+
+    Prints metric name with channel label
+*/
+/**************************************************************************/
+void MAX31855metrics::printLabel(Print &out, const __FlashStringHelper *name, uint8_t channel)
+{
+  out.print(name);
+  out.print(F("{channel=\""));
+  out.print(channel);
+  out.print(F("\"} "));
+}
+
+/**************************************************************************/
+/*
+    printFixed()
+
+    Prints fixed point value without floating point math
+
+    NOTE:
+    - prints value / divider, divider is 10^qnt. of digits after the point
+    - value / divider must fit uint32_t
+*/
+/**************************************************************************/
+void MAX31855metrics::printFixed(Print &out, uint64_t value, uint32_t divider)
+{
+  uint32_t fraction = value % divider;
+
+  out.print((uint32_t)(value / divider));
+  out.print('.');
+
+  for (divider /= 10; divider > 1 && fraction < divider; divider /= 10) out.print('0'); //leading zeros of fraction
+
+  out.print(fraction);
+}
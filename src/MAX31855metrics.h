@@ -0,0 +1,57 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. OpenMetrics text exposition.
+
+   - per channel temperatures, fault state, read & fault counters, read latency histogram
+   - rendered directly to any Print stream (Serial, WiFiClient, EthernetClient),
+     no heap, no String, no floating point
+   - serve it over HTTP, for example ESP8266/ESP32 WiFiServer, for Prometheus scraping
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX31855metrics_h
+#define MAX31855metrics_h
+
+#include <MAX31855.h>
+#include <MAX31855format.h>
+
+#define MAX31855_METRICS_CHANNELS 8 //qnt. of channels
+#define MAX31855_METRICS_BUCKETS  5 //qnt. of latency histogram buckets, without +Inf
+
+
+class MAX31855metrics
+{
+  public:
+   MAX31855metrics(void);
+
+   void     update(uint8_t channel, MAX31855 &sensor, int32_t rawData);
+   void     print(Print &out);
+ 
+  private:
+   typedef struct
+   {
+     bool     valid;
+     uint8_t  status;                                    //see MAX31855::detectThermocouple()
+     int16_t  code;                                      //in 0.25°C steps
+     int16_t  coldJunctionCode;                          //in 0.0625°C steps
+     uint32_t reads;
+     uint32_t faults;
+     uint64_t latencySum;                                //in microseconds, uint32_t overflows after ~72 minutes at 10Hz
+     uint32_t latencyBucket[MAX31855_METRICS_BUCKETS];   //not cumulative, summed when printed
+   } Channel;
+
+   Channel _channel[MAX31855_METRICS_CHANNELS];
+
+   void     printHeader(Print &out, const __FlashStringHelper *name, const __FlashStringHelper *type);
+   void     printLabel(Print &out, const __FlashStringHelper *name, uint8_t channel);
+   void     printFixed(Print &out, uint64_t value, uint32_t divider);
+};
+
+#endif
@@ -0,0 +1,162 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. Latency-compensating alpha-beta predictor.
+
+   - tracks temperature & rate of change from timestamped samples
+   - estimates temperature at current or requested time, so channels read at
+     different times can be aligned & conversion latency is compensated
+   - works with integer 0.25°C codes, see MAX31855::getTemperatureCode()
+   - alpha & beta are Q8, 256 is 1.0, critically damped beta = alpha^2 / (2 - alpha)
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX31855predictor.h>
+
+
+/**************************************************************************/
+/*
+    MAX31855predictor()
+
+    Constructor for alpha-beta predictor
+
+    NOTE:
+    - alpha & beta are Q8, 256 is 1.0
+*/
+/**************************************************************************/
+MAX31855predictor::MAX31855predictor(uint16_t alpha, uint16_t beta)
+{
+  _alpha = alpha;
+  _beta  = beta;
+
+  reset();
+}
+
+/**************************************************************************/
+/*
+    update()
+
+    Adds new sample timestamped with millis()
+*/
+/**************************************************************************/
+bool MAX31855predictor::update(int16_t code)
+{
+  return update(code, millis());
+}
+
+/**************************************************************************/
+/*
+    update()
+
+    Adds new sample with time in milliseconds
+
+    NOTE:
+    - code in 0.25°C steps, see MAX31855::getTemperatureCode()
+    - use MAX31855::getSampleTime() as time, it is the true conversion
+      start & not the time when readRawData() returned
+    - MAX31855_ERROR_CODE is ignored & returns false
+    - predicted  = position + velocity * dt
+      residual   = code - predicted
+      position   = predicted + alpha * residual
+      velocity  += beta * residual / dt
+*/
+/**************************************************************************/
+bool MAX31855predictor::update(int16_t code, uint32_t time)
+{
+  int32_t timeStep;
+  int32_t residual;
+
+  if (code == MAX31855_ERROR_CODE) return false;
+
+  if (_tracking == false)
+  {
+    _position = (int32_t)code << 8;
+    _velocity = 0;
+    _time     = time;
+    _tracking = true;
+
+    return true;
+  }
+
+  timeStep  = time - _time;                                          //unsigned difference survives millis() overflow
+  _position = _position + (int32_t)(((int64_t)_velocity * timeStep) >> 12); //Q20 * msec -> Q8
+  residual  = ((int32_t)code << 8) - _position;
+
+  _position = _position + (((int32_t)_alpha * residual) >> 8);
+
+  if (timeStep > 0) _velocity = _velocity + (int32_t)(((int64_t)_beta * residual * 16) / timeStep); //Q8 * Q8 * 16 / msec -> Q20
+
+  _time = time;
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    getCode()
+
+    Returns temperature estimated at current millis(), in 0.25°C steps
+*/
+/**************************************************************************/
+int16_t MAX31855predictor::getCode(void)
+{
+  return getCode(millis());
+}
+
+/**************************************************************************/
+/*
+    getCode()
+
+    Returns temperature estimated at requested time, in 0.25°C steps
+
+    NOTE:
+    - time in milliseconds, can be before or after the last sample
+    - returns MAX31855_ERROR_CODE if there is no samples
+*/
+/**************************************************************************/
+int16_t MAX31855predictor::getCode(uint32_t time)
+{
+  int32_t position;
+
+  if (_tracking == false) return MAX31855_ERROR_CODE;
+
+  position = _position + (int32_t)(((int64_t)_velocity * (int32_t)(time - _time)) >> 12);
+
+  return (position + 128) >> 8;                                      //Q8 -> 0.25°C steps with rounding
+}
+
+/**************************************************************************/
+/*
+    getRate()
+
+    Returns rate of change, in 1/256°C per second
+
+    NOTE:
+    - 1 step/msec is 250°C/sec, Q20 -> 1/256°C/sec is * 250 * 256 >> 20
+*/
+/**************************************************************************/
+int32_t MAX31855predictor::getRate(void)
+{
+  return ((int64_t)_velocity * 64000) >> 20;
+}
+
+/**************************************************************************/
+/*
+    reset()
+
+    Clears tracking, next sample restarts the predictor
+*/
+/**************************************************************************/
+void MAX31855predictor::reset(void)
+{
+  _tracking = false;
+  _position = 0;
+  _velocity = 0;
+  _time     = 0;
+}
@@ -0,0 +1,50 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. Latency-compensating alpha-beta predictor.
+
+   - tracks temperature & rate of change from timestamped samples
+   - estimates temperature at current or requested time, so channels read at
+     different times can be aligned & conversion latency is compensated
+   - works with integer 0.25°C codes, see MAX31855::getTemperatureCode()
+   - alpha & beta are Q8, 256 is 1.0, critically damped beta = alpha^2 / (2 - alpha)
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX31855predictor_h
+#define MAX31855predictor_h
+
+#include <MAX31855.h>
+
+#define MAX31855_PREDICTOR_ALPHA 128 //0.5 in Q8, higher is faster response but more noise
+#define MAX31855_PREDICTOR_BETA  43  //0.167 in Q8, critically damped for alpha 0.5
+
+
+class MAX31855predictor
+{
+  public:
+   MAX31855predictor(uint16_t alpha = MAX31855_PREDICTOR_ALPHA, uint16_t beta = MAX31855_PREDICTOR_BETA);
+
+   bool     update(int16_t code);
+   bool     update(int16_t code, uint32_t time);
+   int16_t  getCode(void);
+   int16_t  getCode(uint32_t time);
+   int32_t  getRate(void);
+   void     reset(void);
+ 
+  private:
+   uint16_t _alpha;
+   uint16_t _beta;
+   bool     _tracking;
+   int32_t  _position;                                   //in 1/256 of 0.25°C step, Q8
+   int32_t  _velocity;                                   //in 0.25°C steps per millisecond, Q20
+   uint32_t _time;                                       //time of the last sample, in milliseconds
+};
+
+#endif
@@ -0,0 +1,193 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation, four chips conneted to ESP32 SPI controller
+   in quad mode with maximum sampling rate ~9..10Hz.
+
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+     Optimal performance of cold junction compensation happends when the thermocouple cold junction
+     & the MAX31855 are at the same temperature. Avoid placing heat-generating devices or components
+     near the converter because this may produce an errors.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   Frameworks & Libraries:
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX31855quad.h>
+
+#if defined(ESP32)
+
+
+/**************************************************************************/
+/*
+    MAX31855quad()
+
+    Constructor for four sensors on SPI controller in quad mode
+
+    NOTE:
+    cs     - chip select, common for all sensors
+    sck    - serial clock input, common for all sensors
+    d0..d3 - SO of sensor 1..4, wired to controller data lines
+    host   - SPI controller, for example HSPI_HOST/SPI2_HOST, must not be
+             used by Arduino SPI instance
+*/
+/**************************************************************************/
+MAX31855quad::MAX31855quad(uint8_t cs, uint8_t sck, uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3, spi_host_device_t host) : MAX31855(cs)
+{
+  _sck     = sck;
+  _data[0] = d0;
+  _data[1] = d1;
+  _data[2] = d2;
+  _data[3] = d3;
+  _host    = host;
+  _device  = NULL;
+}
+
+/**************************************************************************/
+/*
+    beginNoWait()
+
+    Initializes & configures SPI controller in quad half-duplex mode
+    without waiting for power-up
+
+    NOTE:
+    - power-up deadline is stored & honored by the first read
+    - CS stays regular GPIO, it is used by startConversion()
+    - SCK is set by setSpiClock() before begin(), up to 5MHz
+    - if controller can't be initialized, read returns 0 &
+      detectThermocouple() returns MAX31855_THERMOCOUPLE_READ_FAIL
+*/
+/**************************************************************************/
+void MAX31855quad::beginNoWait(void)
+{
+  spi_bus_config_t              bus;
+  spi_device_interface_config_t device;
+
+  pinMode(_cs, OUTPUT);
+  digitalWrite(_cs, HIGH);                  //disables SPI interface for MAX31855, but it will initiate measurement/conversion
+
+  memset(&bus, 0, sizeof(bus));
+
+  bus.mosi_io_num     = _data[0];
+  bus.miso_io_num     = _data[1];
+  bus.quadwp_io_num   = _data[2];
+  bus.quadhd_io_num   = _data[3];
+  bus.sclk_io_num     = _sck;
+  bus.max_transfer_sz = MAX31855_QUAD_STREAM;
+  bus.flags           = SPICOMMON_BUSFLAG_MASTER | SPICOMMON_BUSFLAG_QUAD;
+
+  memset(&device, 0, sizeof(device));
+
+  device.mode           = 0;                //SPI_MODE0
+  device.clock_speed_hz = _spiClock;
+  device.spics_io_num   = -1;               //CS is driven by software
+  device.queue_size     = 1;
+  device.flags          = SPI_DEVICE_HALFDUPLEX;
+
+  _device = NULL;
+
+  if (spi_bus_initialize(_host, &bus, SPI_DMA_DISABLED) == ESP_OK)
+  {
+    if (spi_bus_add_device(_host, &device, &_device) != ESP_OK) _device = NULL;
+  }
+
+  _powerUpTime = millis();
+  _powerUp     = true;
+}
+
+/**************************************************************************/
+/*
+    readRawDataQuad()
+
+    Reads raw data from all four sensors
+
+    NOTE:
+    - all sensors convert at the same time & one transaction reads all
+      of them
+    - rawData[] must have 4 elements, 0 is read fail
+    - see MAX31855::readFrame() for bits description
+*/
+/**************************************************************************/
+void MAX31855quad::readRawDataQuad(int32_t rawData[])
+{
+  startConversion();
+  waitConversion();
+
+  readFrames(rawData);
+  _readMicros = micros();
+}
+
+/**************************************************************************/
+/*
+    readFrames()
+
+    Reads four 32-bit frames via one quad half-duplex transaction
+
+    NOTE:
+    - 128 bits are received in 32 SCK clocks
+    - CS to SCK delay > 100nS is covered by transaction setup
+*/
+/**************************************************************************/
+bool MAX31855quad::readFrames(int32_t rawData[])
+{
+  uint32_t          stream[MAX31855_QUAD_STREAM / 4];              //word aligned for SPI driver
+  spi_transaction_t transaction;
+  esp_err_t         error;
+
+  for (uint8_t line = 0; line < MAX31855_QUAD_LINES; line++) rawData[line] = 0;
+
+  if (_device == NULL) return false;
+
+  memset(&transaction, 0, sizeof(transaction));
+
+  transaction.flags     = SPI_TRANS_MODE_QIO;
+  transaction.length    = 0;                                       //nothing to send
+  transaction.rxlength  = MAX31855_QUAD_STREAM * 8;                //in bits
+  transaction.rx_buffer = stream;
+
+  digitalWrite(_cs, LOW);                                          //set CS low to enable SPI interface for all MAX31855
+
+  error = spi_device_polling_transmit(_device, &transaction);
+
+  digitalWrite(_cs, HIGH);                                         //disables SPI interface for all MAX31855, but it will initiate measurement/conversion
+
+  if (error != ESP_OK) return false;
+
+  MAX31855unzip::deinterleave((const uint8_t *)stream, rawData);
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    readFrame()
+
+    Reads 32-bit frame from the first MAX31855 via quad transaction
+
+    NOTE:
+    - other three frames are dropped, use readRawDataQuad() to get them
+*/
+/**************************************************************************/
+int32_t MAX31855quad::readFrame(void)
+{
+  int32_t rawData[MAX31855_QUAD_LINES];
+
+  readFrames(rawData);
+
+  return rawData[0];
+}
+
+#endif
@@ -0,0 +1,73 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation, four chips conneted to ESP32 SPI controller
+   in quad mode with maximum sampling rate ~9..10Hz.
+
+   - four chips share CS & SCK, SO of each chip is wired to own controller data line,
+     one 32-clock quad transaction reads all four frames
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+     Optimal performance of cold junction compensation happends when the thermocouple cold junction
+     & the MAX31855 are at the same temperature. Avoid placing heat-generating devices or components
+     near the converter because this may produce an errors.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   This sensor uses SPI controller data lines, any GPIO can be used via GPIO matrix
+   Board:                                    D0/MOSI     D1/MISO     D2/WP        D3/HD        Level
+   ESP32, HSPI.............................. GPIO13      GPIO12      GPIO2        GPIO4        3v
+   ESP32, VSPI.............................. GPIO23      GPIO19      GPIO22       GPIO21       3v
+
+                                             *D0..D3 are SO of sensor 1..4, CS & SCK are common
+
+   Frameworks & Libraries:
+   ESP32   Core          - https://github.com/espressif/arduino-esp32
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX31855quad_h
+#define MAX31855quad_h
+
+#define MAX31855_SOFT_SPI //disable upload hw driver spi.h
+
+#include <MAX31855.h>
+
+#if defined(ESP32)                                         //compile only for ESP32 family
+
+#include <driver/spi_master.h>
+#include <MAX31855unzip.h>
+
+
+class MAX31855quad : public MAX31855
+{
+  public:
+   MAX31855quad(uint8_t cs, uint8_t sck, uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3, spi_host_device_t host);
+
+   void     beginNoWait(void);
+   void     readRawDataQuad(int32_t rawData[]);
+ 
+  private:
+   uint8_t             _sck;
+   uint8_t             _data[MAX31855_QUAD_LINES];
+   spi_host_device_t   _host;
+   spi_device_handle_t _device;
+
+   bool     readFrames(int32_t rawData[]);
+
+  protected:
+   int32_t  readFrame(void);
+};
+
+#endif
+
+#endif
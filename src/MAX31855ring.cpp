@@ -0,0 +1,206 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. Lock-free sample ring with seqlocks.
+
+   - one writer (loop, ISR, RTOS task or other core) publishes raw frames
+   - any number of readers get them without locks & without disabling interrupts
+   - every ring slot & every channel latest-value entry is guarded by own
+     sequence counter, odd while it is written, reader retries if it changed
+   - readers keep own cursor, slow reader skips overwritten samples
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+
+#include <MAX31855ring.h>
+
+
+/**************************************************************************/
+/*
+    MAX31855ring()
+
+    Constructor for lock-free sample ring
+*/
+/**************************************************************************/
+MAX31855ring::MAX31855ring(void)
+{
+  _head = 0;
+
+  for (uint8_t i = 0; i < MAX31855_RING_SIZE; i++)     _ring[i].sequence   = 0;
+  for (uint8_t i = 0; i < MAX31855_RING_CHANNELS; i++) _latest[i].sequence = 0;
+}
+
+/**************************************************************************/
+/*
+    publish()
+
+    Publishes new sample to the ring & to the channel latest-value table
+
+    NOTE:
+    - only one writer is allowed, it is never blocked by readers
+    - on single core mcu reader must not interrupt the writer, for example
+      writer in ISR & readers in loop() is fine, but not vice versa
+    - sample n is complete when its slot sequence is 2 * n + 2
+*/
+/**************************************************************************/
+void MAX31855ring::publish(uint8_t channel, int32_t rawData, uint32_t time)
+{
+  MAX31855_Sample sample;
+  uint32_t        head = _head;
+
+  sample.channel = channel;
+  sample.rawData = rawData;
+  sample.time    = time;
+
+  write(_ring[head & (MAX31855_RING_SIZE - 1)], sample, 2 * head);
+
+  if (channel < MAX31855_RING_CHANNELS) write(_latest[channel], sample, _latest[channel].sequence);
+
+  MAX31855_MEMORY_BARRIER();
+
+  _head = head + 1;
+}
+
+/**************************************************************************/
+/*
+    read()
+
+    Reads next sample for reader with own cursor
+
+    NOTE:
+    - cursor is the qnt. of samples seen by this reader, start with 0
+      or getHead() to skip old samples
+    - returns false if there is no new sample
+    - if reader is slower than writer, overwritten samples are skipped
+      & cursor jumps to the oldest sample in the ring
+*/
+/**************************************************************************/
+bool MAX31855ring::read(uint32_t &cursor, MAX31855_Sample &sample)
+{
+  uint32_t head;
+  uint32_t sequence;
+
+  while (true)
+  {
+    head = getHead();
+
+    MAX31855_MEMORY_BARRIER();
+
+    if (cursor == head) return false;                                //no new samples
+
+    if ((head - cursor) > MAX31855_RING_SIZE) cursor = head - MAX31855_RING_SIZE; //skip overwritten samples
+
+    sequence = copy(_ring[cursor & (MAX31855_RING_SIZE - 1)], sample);
+
+    if (sequence == (2 * cursor + 2))                                //expected sample & not torn
+    {
+      cursor++;
+
+      return true;
+    }
+  }
+}
+
+/**************************************************************************/
+/*
+    getLatest()
+
+    Reads the latest sample of the channel
+
+    NOTE:
+    - returns false if channel is out of table or has no samples yet
+*/
+/**************************************************************************/
+bool MAX31855ring::getLatest(uint8_t channel, MAX31855_Sample &sample)
+{
+  if (channel >= MAX31855_RING_CHANNELS) return false;
+
+  return copy(_latest[channel], sample) != 0;
+}
+
+/**************************************************************************/
+/*
+    getHead()
+
+    Returns qnt. of published samples
+
+    NOTE:
+    - 32-bit read is not atomic on 8-bit mcu, so it is repeated until
+      two reads are the same
+*/
+/**************************************************************************/
+uint32_t MAX31855ring::getHead(void)
+{
+  uint32_t head;
+
+  do
+  {
+    head = _head;
+  }
+  while (head != _head);
+
+  return head;
+}
+
+/**************************************************************************/
+/*
+    write()
+
+    Writes sample to the slot guarded by sequence counter
+
+    NOTE:
+    - sequence is odd while the slot is written
+*/
+/**************************************************************************/
+void MAX31855ring::write(Slot &slot, const MAX31855_Sample &sample, uint32_t sequence)
+{
+  slot.sequence = sequence + 1;                                      //odd, slot is being written
+
+  MAX31855_MEMORY_BARRIER();
+
+  slot.sample = sample;
+
+  MAX31855_MEMORY_BARRIER();
+
+  slot.sequence = sequence + 2;                                      //even, slot is complete
+}
+
+/**************************************************************************/
+/*
+    copy()
+
+    Copies sample from the slot guarded by sequence counter
+
+    NOTE:
+    - retries until the copy is not torn by the writer
+    - returns sequence of the copied sample, 0 if slot is empty
+*/
+/**************************************************************************/
+uint32_t MAX31855ring::copy(const Slot &slot, MAX31855_Sample &sample)
+{
+  uint32_t sequence;
+
+  do
+  {
+    do
+    {
+      sequence = slot.sequence;
+    }
+    while (sequence & 0x01);                                         //writer is busy
+
+    MAX31855_MEMORY_BARRIER();
+
+    sample = slot.sample;
+
+    MAX31855_MEMORY_BARRIER();
+  }
+  while (sequence != slot.sequence);
+
+  return sequence;
+}
@@ -0,0 +1,67 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. Lock-free sample ring with seqlocks.
+
+   - one writer (loop, ISR, RTOS task or other core) publishes raw frames
+   - any number of readers get them without locks & without disabling interrupts
+   - every ring slot & every channel latest-value entry is guarded by own
+     sequence counter, odd while it is written, reader retries if it changed
+   - readers keep own cursor, slow reader skips overwritten samples
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX31855ring_h
+#define MAX31855ring_h
+
+#include <MAX31855.h>
+
+#define MAX31855_RING_SIZE     16 //qnt. of samples in ring, power of 2
+#define MAX31855_RING_CHANNELS 8  //qnt. of channels in latest-value table
+
+#if defined(__AVR__)
+#define MAX31855_MEMORY_BARRIER() __asm__ __volatile__ ("" ::: "memory") //single core, compiler barrier is enough
+#else
+#define MAX31855_MEMORY_BARRIER() __sync_synchronize()                   //multi core, full memory barrier
+#endif
+
+typedef struct
+{
+  uint8_t  channel;
+  int32_t  rawData;                                      //see MAX31855::readRawData()
+  uint32_t time;                                         //sample time, see MAX31855::getSampleTime()
+} MAX31855_Sample;
+
+
+class MAX31855ring
+{
+  public:
+   MAX31855ring(void);
+
+   void     publish(uint8_t channel, int32_t rawData, uint32_t time);
+   bool     read(uint32_t &cursor, MAX31855_Sample &sample);
+   bool     getLatest(uint8_t channel, MAX31855_Sample &sample);
+   uint32_t getHead(void);
+ 
+  private:
+   typedef struct
+   {
+     volatile uint32_t sequence;
+     MAX31855_Sample   sample;
+   } Slot;
+
+   Slot              _ring[MAX31855_RING_SIZE];
+   Slot              _latest[MAX31855_RING_CHANNELS];
+   volatile uint32_t _head;                              //qnt. of published samples
+
+   static void     write(Slot &slot, const MAX31855_Sample &sample, uint32_t sequence);
+   static uint32_t copy(const Slot &slot, MAX31855_Sample &sample);
+};
+
+#endif
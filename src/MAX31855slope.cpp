@@ -0,0 +1,152 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. Rate of change (dT/dt) estimator.
+
+   - least-squares slope over the last MAX31855_SLOPE_WINDOW timestamped samples
+   - O(1) update with running sums, integer only
+   - works with integer 0.25°C codes, see MAX31855::getTemperatureCode()
+   - rate is returned in 1/256°C per second
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX31855slope.h>
+
+
+/**************************************************************************/
+/*
+    MAX31855slope()
+
+    Constructor for rate of change estimator
+*/
+/**************************************************************************/
+MAX31855slope::MAX31855slope(void)
+{
+  reset();
+}
+
+/**************************************************************************/
+/*
+    update()
+
+    Adds new sample timestamped with millis()
+*/
+/**************************************************************************/
+bool MAX31855slope::update(int16_t code)
+{
+  return update(code, millis());
+}
+
+/**************************************************************************/
+/*
+    update()
+
+    Adds new sample with time in milliseconds
+
+    NOTE:
+    - code in 0.25°C steps, see MAX31855::getTemperatureCode()
+    - use MAX31855::getSampleTime() as time, it is the true conversion
+      start & not the time when readRawData() returned
+    - MAX31855_ERROR_CODE is ignored & returns false
+    - sums are kept relative to the newest sample, so the oldest sample is
+      subtracted & the sums are shifted by the new time step:
+      sumTT' = sumTT - 2*d*sumT + n*d^2, sumTY' = sumTY - d*sumY, sumT' = sumT - n*d
+*/
+/**************************************************************************/
+bool MAX31855slope::update(int16_t code, uint32_t time)
+{
+  int64_t timeStep;
+  int64_t oldTime;
+  uint8_t newest;
+
+  if (code == MAX31855_ERROR_CODE) return false;
+
+  if (_count == 0)
+  {
+    _head     = 0;
+    _code[0]  = code;
+    _time[0]  = time;
+    _count    = 1;
+    _sumY     = code;
+
+    return true;
+  }
+
+  newest   = (_head + _count - 1) % MAX31855_SLOPE_WINDOW;
+  timeStep = (uint32_t)(time - _time[newest]);                       //unsigned difference survives millis() overflow
+
+  if (_count == MAX31855_SLOPE_WINDOW)                               //remove the oldest sample
+  {
+    oldTime = -(int64_t)(uint32_t)(_time[newest] - _time[_head]);
+
+    _sumT  -= oldTime;
+    _sumY  -= _code[_head];
+    _sumTT -= oldTime * oldTime;
+    _sumTY -= oldTime * _code[_head];
+
+    _head = (_head + 1) % MAX31855_SLOPE_WINDOW;
+    _count--;
+  }
+
+  _sumTT = _sumTT - 2 * timeStep * _sumT + _count * timeStep * timeStep; //shift time origin to the new sample
+  _sumTY = _sumTY - timeStep * _sumY;
+  _sumT  = _sumT  - _count * timeStep;
+
+  newest        = (_head + _count) % MAX31855_SLOPE_WINDOW;          //add new sample at time 0
+  _code[newest] = code;
+  _time[newest] = time;
+  _sumY        += code;
+  _count++;
+
+  return true;
+}
+
+/**************************************************************************/
+/*
+    getSlope()
+
+    Returns rate of change, in 1/256°C per second
+
+    NOTE:
+    - slope = (n*sumTY - sumT*sumY) / (n*sumTT - sumT^2), in 0.25°C steps
+      per millisecond, 1 step/msec is 250°C/sec
+    - returns 0 if there are less than 2 samples
+*/
+/**************************************************************************/
+int32_t MAX31855slope::getSlope(void)
+{
+  int64_t numerator;
+  int64_t denominator;
+
+  if (_count < 2) return 0;
+
+  numerator   = _count * _sumTY - _sumT * _sumY;
+  denominator = _count * _sumTT - _sumT * _sumT;
+
+  if (denominator == 0) return 0;                                    //all samples have the same time
+
+  return (numerator * (250L * MAX31855_SLOPE_SCALE)) / denominator;
+}
+
+/**************************************************************************/
+/*
+    reset()
+
+    Clears all samples
+*/
+/**************************************************************************/
+void MAX31855slope::reset(void)
+{
+  _head  = 0;
+  _count = 0;
+  _sumT  = 0;
+  _sumY  = 0;
+  _sumTT = 0;
+  _sumTY = 0;
+}
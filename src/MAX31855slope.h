@@ -0,0 +1,50 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. Rate of change (dT/dt) estimator.
+
+   - least-squares slope over the last MAX31855_SLOPE_WINDOW timestamped samples
+   - O(1) update with running sums, integer only
+   - works with integer 0.25°C codes, see MAX31855::getTemperatureCode()
+   - rate is returned in 1/256°C per second
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX31855slope_h
+#define MAX31855slope_h
+
+#include <MAX31855.h>
+
+#define MAX31855_SLOPE_WINDOW 8   //qnt. of samples, more samples less noise but more lag
+#define MAX31855_SLOPE_SCALE  256 //rate units per °C/s
+
+
+class MAX31855slope
+{
+  public:
+   MAX31855slope(void);
+
+   bool     update(int16_t code);
+   bool     update(int16_t code, uint32_t time);
+   int32_t  getSlope(void);
+   void     reset(void);
+ 
+  private:
+   int16_t  _code[MAX31855_SLOPE_WINDOW];
+   uint32_t _time[MAX31855_SLOPE_WINDOW];
+   uint8_t  _head;
+   uint8_t  _count;
+
+   int64_t  _sumT;                                       //time is relative to the newest sample, in milliseconds
+   int64_t  _sumY;
+   int64_t  _sumTT;
+   int64_t  _sumTY;
+};
+
+#endif
@@ -59,43 +59,77 @@
 /**************************************************************************/
 MAX31855soft::MAX31855soft(uint8_t cs, uint8_t so, uint8_t sck) : MAX31855(cs)
 {
-  _so  = so;  //sw miso
-  _sck = sck; //sw sclk
+  _so[0]     = so;                   //sw miso
+  _quantity  = 1;
+  _sck       = sck;                  //sw sclk
+  _irqPolicy = MAX31855_IRQ_DEFAULT;
+  _irqOffMax = 0;
 }
 
 /**************************************************************************/
 /*
-    begin()
+    MAX31855soft()
 
-    Initializes & configures soft/bit-bang SPI
+    Constructor for software/bit-bang read only SPI for sensors sharing
+    one CS & SCK, each sensor has own SO line
+
+    NOTE:
+    cs       - chip select, common for all sensors
+    sck      - serial clock input, common for all sensors
+    so       - serial data outputs, one per sensor
+    quantity - qnt. of sensors, up to 8
 */
 /**************************************************************************/
-void MAX31855soft::begin(void)
+MAX31855soft::MAX31855soft(uint8_t cs, uint8_t sck, const uint8_t so[], uint8_t quantity) : MAX31855(cs)
+{
+  if (quantity > MAX31855_PARALLEL_MAX) quantity = MAX31855_PARALLEL_MAX;
+  if (quantity == 0)                    quantity = 1;
+
+  for (uint8_t i = 0; i < quantity; i++) _so[i] = so[i];
+
+  _quantity  = quantity;
+  _sck       = sck;
+  _irqPolicy = MAX31855_IRQ_DEFAULT;
+  _irqOffMax = 0;
+}
+
+/**************************************************************************/
+/*
+    beginNoWait()
+
+    Initializes & configures soft/bit-bang SPI without waiting for power-up
+
+    NOTE:
+    - power-up deadline is stored & honored by the first read
+*/
+/**************************************************************************/
+void MAX31855soft::beginNoWait(void)
 {
   pinMode(_cs, OUTPUT);
   digitalWrite(_cs, HIGH);                  //disables SPI interface for MAX31855, but it will initiate measurement/conversion
 
-  pinMode(_so, INPUT);
+  for (uint8_t i = 0; i < _quantity; i++) pinMode(_so[i], INPUT);
 
   pinMode(_sck, OUTPUT);
   digitalWrite(_sck, LOW);
 
-  delay(MAX31855_CONVERSION_POWER_UP_TIME);
+  _powerUpTime = millis();
+  _powerUp     = true;
 }
 
 /**************************************************************************/
 /*
-    readRawData()
+    readFrame()
 
-    Reads raw data from MAX31855 via software/bit-bang SPI
+    Reads 32-bit frame from MAX31855 via software/bit-bang SPI
 
     NOTE:
+    - other sensors sharing CS & SCK are clocked too, their frames are
+      dropped, use readRawDataParallel() to get them
     - read of the cold-junction compensated thermocouple temperature requires
       14 clock cycles
     - read of the cold-junction compensated thermocouple temperature & reference
       junction temperatures requires 32 clock cycles
-    - forcing CS low immediately stops any conversion process, force CS high
-      to initiate a new measurement process
     - set CS low to enable the serial interface & force to output the first bit on the SO pin,
       apply 14/32 clock signals at SCK to read the results at SO on the falling edge of the SCK
     - bit D31 is the thermocouple temperature sign bit "+" is high & "-" is low,
@@ -115,35 +149,241 @@ void MAX31855soft::begin(void)
     - SPI_MODE0 -> data available shortly after the rising edge of SCK
 */
 /**************************************************************************/
-int32_t MAX31855soft::readRawData(void)
+int32_t MAX31855soft::readFrame(void)
 {
-  int32_t rawData = 0;
-
-  digitalWrite(_cs, LOW);                        //stop  measurement/conversion
-  delayMicroseconds(1);                          //5MHz  is 0.2μsec, do we need it???
-  digitalWrite(_cs, HIGH);                       //start measurement/conversion
-
-  delay(MAX31855_CONVERSION_TIME);
+  int32_t  rawData = 0;
+  uint32_t offTime = 0;                          //the longest interrupts-off window of this frame, in usec
+  uint32_t timer   = 0;
 
   digitalWrite(_cs, LOW);                        //set CS low to enable SPI interface for MAX31855
 
-  #ifdef MAX31855_DISABLE_INTERRUPTS
-  noInterrupts();                                //disable all interrupts for critical operations below
-  #endif
+  if (_irqPolicy == MAX31855_IRQ_FRAME)
+  {
+    timer = micros();
+    noInterrupts();                              //disable all interrupts for critical operations below
+  }
 
   /* emulate SPI_MODE0 */
   for (int8_t i = 32; i > 0; i--)                //read 32-bits via software SPI, in order MSB->LSB (D31..D0 bit)
   {
+    if (_irqPolicy == MAX31855_IRQ_EDGE)
+    {
+      timer = micros();
+      noInterrupts();                            //disable all interrupts for one clock
+    }
+
     digitalWrite(_sck, HIGH);                    //data available shortly after rising edge of SCK
-    rawData = (rawData << 1) | digitalRead(_so);
+    rawData = (rawData << 1) | digitalRead(_so[0]);
     digitalWrite(_sck, LOW);                     //data is clocked out on falling edge of SCK
+
+    if (_irqPolicy == MAX31855_IRQ_EDGE)
+    {
+      timer = micros() - timer;                  //micros() is valid with masked interrupts, pending ISR is not counted
+      interrupts();                              //re-enable all interrupts, pending ones are served here
+
+      if (timer > offTime) offTime = timer;
+    }
   }
 
-  #ifdef MAX31855_DISABLE_INTERRUPTS
-  interrupts();                                  //re-enable all interrupts
-  #endif
+  if (_irqPolicy == MAX31855_IRQ_FRAME)
+  {
+    offTime = micros() - timer;
+    interrupts();                                //re-enable all interrupts
+  }
 
   digitalWrite(_cs, HIGH);                       //disables SPI interface for MAX31855, but it will initiate measurement/conversion
 
+  if (offTime > _irqOffMax) _irqOffMax = offTime;
+
   return rawData;
 }
+
+/**************************************************************************/
+/*
+    setInterruptPolicy()
+
+    Sets interrupts masking during bit-bang
+
+    NOTE:
+    - MAX31855_IRQ_NONE, interrupts are not masked, the best ISR latency,
+      but long ISR between SCK edges only slows down the frame, SPI is
+      static & MAX31855 keeps SO until the next SCK edge, so it is safe
+      unless ISR also drives SCK/CS pins
+    - MAX31855_IRQ_FRAME, interrupts are masked for the whole frame, ISR
+      latency is the whole frame time, ~100..400usec with digitalWrite()
+    - MAX31855_IRQ_EDGE, interrupts are masked for one SCK clock & served
+      between clocks, ISR latency is one clock time, ~5..15usec
+    - default is MAX31855_IRQ_FRAME if MAX31855_DISABLE_INTERRUPTS is
+      defined in MAX31855soft.h, MAX31855_IRQ_NONE otherwise
+    - see getInterruptsOffMax() for measured worst case
+*/
+/**************************************************************************/
+void MAX31855soft::setInterruptPolicy(uint8_t policy)
+{
+  if (policy > MAX31855_IRQ_EDGE) policy = MAX31855_IRQ_FRAME;
+
+  _irqPolicy = policy;
+}
+
+/**************************************************************************/
+/*
+    getInterruptPolicy()
+
+    Returns interrupts masking policy, see setInterruptPolicy()
+*/
+/**************************************************************************/
+uint8_t MAX31855soft::getInterruptPolicy(void)
+{
+  return _irqPolicy;
+}
+
+/**************************************************************************/
+/*
+    getInterruptsOffMax()
+
+    Returns the longest measured time with masked interrupts since
+    reset, in microseconds
+
+    NOTE:
+    - measured by micros() right before masking & right before unmasking,
+      pending ISR served after unmasking is not counted
+    - micros() doesn't advance on timer overflow while interrupts are
+      masked, AVR counts only one overflow, so windows > ~1msec on AVR
+      are reported shorter than real
+    - micros() resolution is 4usec on 16MHz AVR, 1usec on ESP8266, ESP32
+      & STM32
+    - MAX31855_IRQ_EDGE measurement adds 2 micros() calls per clock to
+      the frame, the second one is inside the masked window & counted
+    - always 0 with MAX31855_IRQ_NONE
+*/
+/**************************************************************************/
+uint32_t MAX31855soft::getInterruptsOffMax(void)
+{
+  return _irqOffMax;
+}
+
+/**************************************************************************/
+/*
+    resetInterruptsOffMax()
+
+    Resets the longest measured time with masked interrupts
+*/
+/**************************************************************************/
+void MAX31855soft::resetInterruptsOffMax(void)
+{
+  _irqOffMax = 0;
+}
+
+/**************************************************************************/
+/*
+    readRawDataParallel()
+
+    Reads raw data from all sensors sharing CS & SCK via software/bit-bang
+    SPI
+
+    NOTE:
+    - all sensors convert at the same time & 32 clocks read all of them
+    - rawData[] must have getQuantity() elements
+    - see MAX31855::readFrame() for bits description
+*/
+/**************************************************************************/
+void MAX31855soft::readRawDataParallel(int32_t rawData[])
+{
+  startConversion();
+  waitConversion();
+
+  readFrames(rawData);
+  _readMicros = micros();
+}
+
+/**************************************************************************/
+/*
+    getQuantity()
+
+    Returns qnt. of sensors sharing CS & SCK
+*/
+/**************************************************************************/
+uint8_t MAX31855soft::getQuantity(void)
+{
+  return _quantity;
+}
+
+/**************************************************************************/
+/*
+    readFrames()
+
+    Reads 32-bit frames from all MAX31855 sharing CS & SCK via
+    software/bit-bang SPI
+
+    NOTE:
+    - SO lines are sampled via port input registers, SO lines of the same
+      port listed one after another are sampled by one port read per clock,
+      for example 8 SO lines on AVR PORTD take 1 read per clock
+    - SCK is driven by digitalWrite(), it is atomic, AVR core masks
+      interrupts inside, ARM & ESP cores use set/clear registers, so
+      ISR may change other pins of SCK port with any interrupts policy
+    - interrupts are masked by setInterruptPolicy()
+*/
+/**************************************************************************/
+void MAX31855soft::readFrames(int32_t rawData[])
+{
+  MAX31855_PortReg  *soPin[MAX31855_PARALLEL_MAX];
+  MAX31855_PortMask  soMask[MAX31855_PARALLEL_MAX];
+  MAX31855_PortMask  portValue = 0;
+  uint32_t           offTime   = 0;                //the longest interrupts-off window of this frame, in usec
+  uint32_t           timer     = 0;
+
+  for (uint8_t i = 0; i < _quantity; i++)
+  {
+    soPin[i]   = portInputRegister(digitalPinToPort(_so[i]));
+    soMask[i]  = digitalPinToBitMask(_so[i]);
+    rawData[i] = 0;
+  }
+
+  digitalWrite(_cs, LOW);                        //set CS low to enable SPI interface for all MAX31855
+
+  if (_irqPolicy == MAX31855_IRQ_FRAME)
+  {
+    timer = micros();
+    noInterrupts();                              //disable all interrupts for critical operations below
+  }
+
+  /* emulate SPI_MODE0 */
+  for (int8_t bit = 32; bit > 0; bit--)          //read 32-bits via software SPI, in order MSB->LSB (D31..D0 bit)
+  {
+    if (_irqPolicy == MAX31855_IRQ_EDGE)
+    {
+      timer = micros();
+      noInterrupts();                            //disable all interrupts for one clock
+    }
+
+    digitalWrite(_sck, HIGH);                    //data available shortly after rising edge of SCK
+
+    for (uint8_t i = 0; i < _quantity; i++)
+    {
+      if (i == 0 || soPin[i] != soPin[i - 1]) portValue = *soPin[i]; //one read per port
+
+      rawData[i] = (rawData[i] << 1) | ((portValue & soMask[i]) != 0);
+    }
+
+    digitalWrite(_sck, LOW);                     //data is clocked out on falling edge of SCK
+
+    if (_irqPolicy == MAX31855_IRQ_EDGE)
+    {
+      timer = micros() - timer;                  //micros() is valid with masked interrupts, pending ISR is not counted
+      interrupts();                              //re-enable all interrupts, pending ones are served here
+
+      if (timer > offTime) offTime = timer;
+    }
+  }
+
+  if (_irqPolicy == MAX31855_IRQ_FRAME)
+  {
+    offTime = micros() - timer;
+    interrupts();                                //re-enable all interrupts
+  }
+
+  digitalWrite(_cs, HIGH);                       //disables SPI interface for all MAX31855, but it will initiate measurement/conversion
+
+  if (offTime > _irqOffMax) _irqOffMax = offTime;
+}
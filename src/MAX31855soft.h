@@ -50,7 +50,8 @@
    it in the library, because the Arduino toolchain includes library
    files & compiles them in advance, not knowing where it will be used.
 
-   - uncomment to disable interrupts during bit-bang
+   - uncomment to disable interrupts during bit-bang by default,
+     see setInterruptPolicy() to change it from the sketch
 */
 //#define MAX31855_DISABLE_INTERRUPTS
 
@@ -58,18 +59,44 @@
 
 #include <MAX31855.h>
 
+#define MAX31855_PARALLEL_MAX 8 //max qnt. of SO lines read in parallel
+
+#define MAX31855_IRQ_NONE     0 //interrupts are not masked during bit-bang
+#define MAX31855_IRQ_FRAME    1 //interrupts are masked for the whole 32-bit frame
+#define MAX31855_IRQ_EDGE     2 //interrupts are masked for every SCK clock only
+
+#ifdef MAX31855_DISABLE_INTERRUPTS
+#define MAX31855_IRQ_DEFAULT  MAX31855_IRQ_FRAME
+#else
+#define MAX31855_IRQ_DEFAULT  MAX31855_IRQ_NONE
+#endif
+
 
 class MAX31855soft : public MAX31855
 {
   public:
    MAX31855soft(uint8_t cs, uint8_t so, uint8_t sck);
+   MAX31855soft(uint8_t cs, uint8_t sck, const uint8_t so[], uint8_t quantity);
 
-   void     begin(void);
-   int32_t  readRawData(void);
+   void     beginNoWait(void);
+   void     readRawDataParallel(int32_t rawData[]);
+   uint8_t  getQuantity(void);
+   void     setInterruptPolicy(uint8_t policy);
+   uint8_t  getInterruptPolicy(void);
+   uint32_t getInterruptsOffMax(void);
+   void     resetInterruptsOffMax(void);
  
   private:
-   uint8_t _so;
-   uint8_t _sck;
+   uint8_t  _so[MAX31855_PARALLEL_MAX];
+   uint8_t  _quantity;
+   uint8_t  _sck;
+   uint8_t  _irqPolicy;
+   uint32_t _irqOffMax;                                  //in microseconds
+
+   void     readFrames(int32_t rawData[]);
+
+  protected:
+   int32_t  readFrame(void);
 };
 
 #endif
@@ -0,0 +1,229 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation conneted to software/bit-bang SPI with maximum
+   sampling rate ~9..10Hz. Tiny footprint version for 4..8KB flash mcu.
+
+   - no hardware SPI driver, no floating point math, no virtual methods
+   - temperatures are returned as integers, 0.25°C & 0.0625°C per step
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+     Optimal performance of cold junction compensation happends when the thermocouple cold junction
+     & the MAX31855 are at the same temperature. Avoid placing heat-generating devices or components
+     near the converter because this may produce an errors.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   Board:                                     Level
+   ATtiny85, ATtiny45, ATtiny25.............  3v/5v
+   ATtiny84, ATtiny44, ATtiny24.............  3v/5v
+   ATtiny2313, ATtiny4313...................  3v/5v
+   Uno, Mini, Pro, ATmega168, ATmega328.....  5v
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX31855tiny.h>
+
+
+/**************************************************************************/
+/*
+    MAX31855tiny()
+
+    Constructor for tiny footprint software/bit-bang read only SPI
+
+    NOTE:
+    cs  - chip select, set CS low to enable the serial interface
+    so  - serial data output
+    sck - serial clock input
+*/
+/**************************************************************************/
+MAX31855tiny::MAX31855tiny(uint8_t cs, uint8_t so, uint8_t sck)
+{
+  _cs  = cs;  //sw cs
+  _so  = so;  //sw miso
+  _sck = sck; //sw sclk
+}
+
+/**************************************************************************/
+/*
+    begin()
+
+    Initializes & configures soft/bit-bang SPI
+
+    NOTE:
+    - pins are accessed via port registers, it is ~10 times faster &
+      smaller than digitalWrite()/digitalRead()
+*/
+/**************************************************************************/
+void MAX31855tiny::begin(void)
+{
+  _csPort  = portOutputRegister(digitalPinToPort(_cs));
+  _csMask  = digitalPinToBitMask(_cs);
+  _soPin   = portInputRegister(digitalPinToPort(_so));
+  _soMask  = digitalPinToBitMask(_so);
+  _sckPort = portOutputRegister(digitalPinToPort(_sck));
+  _sckMask = digitalPinToBitMask(_sck);
+
+  pinMode(_cs, OUTPUT);
+  digitalWrite(_cs, HIGH);                  //disables SPI interface for MAX31855, but it will initiate measurement/conversion
+
+  pinMode(_so, INPUT);
+
+  pinMode(_sck, OUTPUT);
+  digitalWrite(_sck, LOW);
+
+  delay(MAX31855_CONVERSION_POWER_UP_TIME);
+}
+
+/**************************************************************************/
+/*
+    detectThermocouple()
+
+    Checks if thermocouple is open, shorted to GND, shorted to VCC
+
+    Return:
+    - 0 OK
+    - 1 short to VCC
+    - 2 short to GND
+    - 3 not connected
+    - 4 unknown, if MAX31855_TINY_NO_FAULT_DETAIL is defined
+      any fault is unknown
+    - 5 read fail
+
+    NOTE:
+    - see MAX31855::detectThermocouple() for bits description
+*/
+/**************************************************************************/
+uint8_t MAX31855tiny::detectThermocouple(int32_t rawValue)
+{
+  if (rawValue == MAX31855_FORCE_READ_DATA) rawValue = readRawData();
+
+  if (rawValue == 0)                    return MAX31855_THERMOCOUPLE_READ_FAIL;
+
+  if (bitRead(rawValue, 16) == 1)
+  {
+    #ifndef MAX31855_TINY_NO_FAULT_DETAIL
+    if      (bitRead(rawValue, 2) == 1) return MAX31855_THERMOCOUPLE_SHORT_TO_VCC;
+    else if (bitRead(rawValue, 1) == 1) return MAX31855_THERMOCOUPLE_SHORT_TO_GND;
+    else if (bitRead(rawValue, 0) == 1) return MAX31855_THERMOCOUPLE_NOT_CONNECTED;
+    #endif
+                                        return MAX31855_THERMOCOUPLE_UNKNOWN;
+  }
+  return MAX31855_THERMOCOUPLE_OK;
+}
+
+/**************************************************************************/
+/*
+    getChipID()
+
+    Checks chip ID
+
+    NOTE:
+    - bit D17, D3 always return zero & can be used as device ID
+*/
+/**************************************************************************/
+uint16_t MAX31855tiny::getChipID(int32_t rawValue)
+{
+  if (rawValue == MAX31855_FORCE_READ_DATA) rawValue = readRawData();
+
+  if (rawValue == 0)                                           return MAX31855_THERMOCOUPLE_READ_FAIL;
+  if (bitRead(rawValue, 17) == 0 && bitRead(rawValue, 3) == 0) return MAX31855_ID;
+
+  return MAX31855_ERROR;
+}
+
+/**************************************************************************/
+/*
+    getTemperature()
+
+    Reads Temperature, in 0.25°C steps
+
+    NOTE:
+    - returns 14-bit signed value, -270°C..+1372°C is -1080..+5488,
+      divide by 4 to get °C
+    - returns MAX31855_ERROR_CODE if thermocouple is open/shorted
+      or read fail
+*/
+/**************************************************************************/
+int16_t MAX31855tiny::getTemperature(int32_t rawValue)
+{
+  if (rawValue == MAX31855_FORCE_READ_DATA) rawValue = readRawData();
+
+  if (detectThermocouple(rawValue) != MAX31855_THERMOCOUPLE_OK) return MAX31855_ERROR_CODE;
+
+  return rawValue >> 18;                    //clear D17..D0 bits, arithmetic shift keeps the sign
+}
+
+/**************************************************************************/
+/*
+    getColdJunctionTemperature()
+
+    Reads Temperature, in 0.0625°C steps
+
+    NOTE:
+    - returns 12-bit signed value, -40°C..+125°C is -640..+2000,
+      divide by 16 to get °C
+    - returns MAX31855_ERROR_CODE if read fail or not MAX31855
+*/
+/**************************************************************************/
+int16_t MAX31855tiny::getColdJunctionTemperature(int32_t rawValue)
+{
+  if (rawValue == MAX31855_FORCE_READ_DATA) rawValue = readRawData();
+
+  if (getChipID(rawValue) != MAX31855_ID) return MAX31855_ERROR_CODE;
+
+  return (int16_t)rawValue >> 4;            //clear D31..D16 & D3..D0 bits, D15 is the sign
+}
+
+/**************************************************************************/
+/*
+    readRawData()
+
+    Reads raw data from MAX31855 via software/bit-bang SPI
+
+    NOTE:
+    - forcing CS low immediately stops any conversion process, force CS high
+      to initiate a new measurement process
+    - SPI_MODE0 -> data available shortly after the rising edge of SCK
+    - port read-modify-write is not atomic, don't change pins of the same
+      port inside ISR
+    - see MAX31855::readFrame() for bits description
+*/
+/**************************************************************************/
+int32_t MAX31855tiny::readRawData(void)
+{
+  int32_t rawData = 0;
+
+  *_csPort &= ~_csMask;                          //stop  measurement/conversion
+  delayMicroseconds(1);                          //pulse fall time > 100nS
+  *_csPort |= _csMask;                           //start measurement/conversion
+
+  delay(MAX31855_CONVERSION_TIME);
+
+  *_csPort &= ~_csMask;                          //set CS low to enable SPI interface for MAX31855
+
+  /* emulate SPI_MODE0 */
+  for (uint8_t i = 32; i > 0; i--)               //read 32-bits via software SPI, in order MSB->LSB (D31..D0 bit)
+  {
+    *_sckPort |= _sckMask;                       //data available shortly after rising edge of SCK
+    rawData = rawData << 1;
+    if ((*_soPin & _soMask) != 0) rawData |= 1;
+    *_sckPort &= ~_sckMask;                      //data is clocked out on falling edge of SCK
+  }
+
+  *_csPort |= _csMask;                           //disables SPI interface for MAX31855, but it will initiate measurement/conversion
+
+  return rawData;
+}
@@ -0,0 +1,80 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation conneted to software/bit-bang SPI with maximum
+   sampling rate ~9..10Hz. Tiny footprint version for 4..8KB flash mcu.
+
+   - no hardware SPI driver, no floating point math, no virtual methods
+   - temperatures are returned as integers, 0.25°C & 0.0625°C per step
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+     Optimal performance of cold junction compensation happends when the thermocouple cold junction
+     & the MAX31855 are at the same temperature. Avoid placing heat-generating devices or components
+     near the converter because this may produce an errors.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   Board:                                     Level
+   ATtiny85, ATtiny45, ATtiny25.............  3v/5v
+   ATtiny84, ATtiny44, ATtiny24.............  3v/5v
+   ATtiny2313, ATtiny4313...................  3v/5v
+   Uno, Mini, Pro, ATmega168, ATmega328.....  5v
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX31855tiny_h
+#define MAX31855tiny_h
+
+/*
+   Unfortunately, you cannot #define something in the sketch & get
+   it in the library, because the Arduino toolchain includes library
+   files & compiles them in advance, not knowing where it will be used.
+
+   - uncomment to strip thermocouple fault details, detectThermocouple()
+     returns only OK, UNKNOWN or READ_FAIL
+*/
+//#define MAX31855_TINY_NO_FAULT_DETAIL
+
+#define MAX31855_SOFT_SPI //disable upload hw driver spi.h
+
+#include <MAX31855.h>
+
+
+class MAX31855tiny
+{
+  public:
+   MAX31855tiny(uint8_t cs, uint8_t so, uint8_t sck);
+
+   void     begin(void);
+   uint8_t  detectThermocouple(int32_t rawValue = MAX31855_FORCE_READ_DATA);
+   uint16_t getChipID(int32_t rawValue = MAX31855_FORCE_READ_DATA);
+   int16_t  getTemperature(int32_t rawValue = MAX31855_FORCE_READ_DATA);
+   int16_t  getColdJunctionTemperature(int32_t rawValue = MAX31855_FORCE_READ_DATA);
+   int32_t  readRawData(void);
+ 
+  private:
+   uint8_t            _cs;
+   uint8_t            _so;
+   uint8_t            _sck;
+
+   MAX31855_PortReg  *_csPort;
+   MAX31855_PortReg  *_soPin;
+   MAX31855_PortReg  *_sckPort;
+   MAX31855_PortMask  _csMask;
+   MAX31855_PortMask  _soMask;
+   MAX31855_PortMask  _sckMask;
+};
+
+#endif
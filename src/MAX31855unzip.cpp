@@ -0,0 +1,70 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. Quad SPI stream de-interleave kernel.
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <MAX31855unzip.h>
+
+
+/**************************************************************************/
+/*
+    deinterleave()
+
+    Splits 16-byte quad stream into four 32-bit frames
+
+    NOTE:
+    - every SCK clock receives one nibble, the first nibble is in bits
+      7..4 of the first byte, nibble bit n is data line n
+    - frame n bit D31 is bit n of the first nibble, bit D0 is bit n of
+      the last nibble
+    - every 4 bytes hold 8 clocks, they are unzipped into one byte of
+      every frame, MSB first
+*/
+/**************************************************************************/
+void MAX31855unzip::deinterleave(const uint8_t stream[], int32_t rawData[])
+{
+  uint32_t word;
+  uint32_t frame[MAX31855_QUAD_LINES] = {0, 0, 0, 0};
+
+  for (uint8_t i = 0; i < MAX31855_QUAD_STREAM; i += 4)
+  {
+    word = ((uint32_t)stream[i] << 24) | ((uint32_t)stream[i + 1] << 16) | ((uint32_t)stream[i + 2] << 8) | stream[i + 3];
+
+    for (uint8_t line = 0; line < MAX31855_QUAD_LINES; line++)
+    {
+      frame[line] = (frame[line] << 8) | unzip(word, line);
+    }
+  }
+
+  for (uint8_t line = 0; line < MAX31855_QUAD_LINES; line++) rawData[line] = frame[line];
+}
+
+/**************************************************************************/
+/*
+    unzip()
+
+    Gathers every 4-th bit of 32-bit word starting from line bit into
+    one byte
+
+    NOTE:
+    - bits 28, 24..0 + line become bits 7, 6..0, three shift & mask
+      steps instead of 8 single bit moves
+*/
+/**************************************************************************/
+uint8_t MAX31855unzip::unzip(uint32_t word, uint8_t line)
+{
+  word = (word >> line)         & 0x11111111;                      //every 4-th bit
+  word = (word | (word >> 3))   & 0x03030303;                      //bit pairs
+  word = (word | (word >> 6))   & 0x000F000F;                      //nibbles
+  word = (word | (word >> 12))  & 0x000000FF;                      //byte
+
+  return word;
+}
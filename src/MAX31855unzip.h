@@ -0,0 +1,36 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation. Quad SPI stream de-interleave kernel.
+
+   - splits 16-byte stream of 32 quad SPI clocks into four 32-bit frames, see MAX31855quad
+   - plain C++ without Arduino dependencies, so it is unit-tested on the host,
+     see extras/test/MAX31855unzip_test.cpp
+
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX31855unzip_h
+#define MAX31855unzip_h
+
+#include <stdint.h>
+
+#define MAX31855_QUAD_LINES  4                             //qnt. of sensors per transaction
+#define MAX31855_QUAD_STREAM 16                            //bytes per transaction, 32 clocks * 4 lines / 8
+
+
+class MAX31855unzip
+{
+  public:
+   static void    deinterleave(const uint8_t stream[], int32_t rawData[]);
+
+  private:
+   static uint8_t unzip(uint32_t word, uint8_t line);
+};
+
+#endif
@@ -0,0 +1,157 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation conneted to ATtiny USI (Universal Serial Interface)
+   in three-wire/SPI mode with maximum sampling rate ~9..10Hz.
+
+   - USI shifts bits in hardware, cpu only strobes the clock, so the frame takes
+     ~64..128 cpu cycles & interrupts are never disabled
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+     Optimal performance of cold junction compensation happends when the thermocouple cold junction
+     & the MAX31855 are at the same temperature. Avoid placing heat-generating devices or components
+     near the converter because this may produce an errors.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   This sensor uses USI to communicate, specials pins are required to interface
+   Board:                                     DI/SO       DO/x        USCK/SCK     Level
+   ATtiny85, ATtiny45, ATtiny25.............  PB0         PB1         PB2          3v/5v
+   ATtiny84, ATtiny44, ATtiny24.............  PA6         PA5         PA4          3v/5v
+   ATtiny2313, ATtiny4313...................  PB5         PB6         PB7          3v/5v
+
+                                              *DO is not used & stays free
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+
+#include <MAX31855usi.h>
+
+#if defined(MAX31855_USI_DDR)
+
+#define MAX31855_USI_CLOCK        (_BV(USIWM0) | _BV(USICS1) | _BV(USICLK) | _BV(USITC)) //three-wire mode, toggle USCK, shift data register on USCK rising edge
+
+#if F_CPU > 10000000UL
+#define MAX31855_USI_STROBE()     USICR = MAX31855_USI_CLOCK; __asm__ __volatile__ ("nop"); \
+                                  USICR = MAX31855_USI_CLOCK; __asm__ __volatile__ ("nop")
+#else
+#define MAX31855_USI_STROBE()     USICR = MAX31855_USI_CLOCK; \
+                                  USICR = MAX31855_USI_CLOCK
+#endif
+
+
+/**************************************************************************/
+/*
+    MAX31855usi()
+
+    Constructor for USI read only SPI
+
+    NOTE:
+    - cs is chip select, set cs low to enable serial interface
+    - SO & SCK are fixed USI DI & USCK pins, see table above
+*/
+/**************************************************************************/
+MAX31855usi::MAX31855usi(uint8_t cs) : MAX31855(cs)
+{
+}
+
+/**************************************************************************/
+/*
+    beginNoWait()
+
+    Initializes & configures USI without waiting for power-up
+
+    NOTE:
+    - power-up deadline is stored & honored by the first read
+*/
+/**************************************************************************/
+void MAX31855usi::beginNoWait(void)
+{
+  pinMode(_cs, OUTPUT);
+  digitalWrite(_cs, HIGH);                  //disables SPI interface for MAX31855, but it will initiate measurement/conversion
+
+  MAX31855_USI_DDR |=  _BV(MAX31855_USI_USCK); //USCK output, idle low
+  MAX31855_USI_DDR &= ~_BV(MAX31855_USI_DI);   //DI input
+
+  USICR = _BV(USIWM0);                      //three-wire mode, clock is strobed by software
+
+  _powerUpTime = millis();
+  _powerUp     = true;
+}
+
+/**************************************************************************/
+/*
+    transfer()
+
+    Reads 8-bits via USI, in order MSB->LSB
+
+    NOTE:
+    - USI clock source is external positive edge & USITC strobe, so USI
+      drives USCK itself & samples DI on USCK rising edge in hardware,
+      the same as SPI_MODE0 & AVR319 SPI master
+    - 1-st write toggles USCK high, DI is shifted into data register
+    - 2-nd write toggles USCK low, MAX31855 clocks out next bit on falling
+      edge, it is sampled by the next rising edge
+    - high & low SCK time must be > 100nS, for F_CPU > 10MHz nop is added,
+      SCK is 4MHz for 8MHz & 16MHz mcu
+    - see extras/test/MAX31855usi_test.cpp for host test of the frame
+      assembly against USI & MAX31855 models
+*/
+/**************************************************************************/
+uint8_t MAX31855usi::transfer(void)
+{
+  USIDR = 0x00;                             //DO is not connected, doesn't metter what to send
+
+  MAX31855_USI_STROBE();                    //D7
+  MAX31855_USI_STROBE();                    //D6
+  MAX31855_USI_STROBE();                    //D5
+  MAX31855_USI_STROBE();                    //D4
+  MAX31855_USI_STROBE();                    //D3
+  MAX31855_USI_STROBE();                    //D2
+  MAX31855_USI_STROBE();                    //D1
+  MAX31855_USI_STROBE();                    //D0
+
+  return USIDR;
+}
+
+/**************************************************************************/
+/*
+    readFrame()
+
+    Reads 32-bit frame from MAX31855 via USI
+
+    NOTE:
+    - see MAX31855::readFrame() for bits description
+    - interrupt during transfer only stretches SCK, SPI is static & frame
+      stays valid, so interrupts are not disabled
+*/
+/**************************************************************************/
+int32_t MAX31855usi::readFrame(void)
+{
+  int32_t rawData = 0;
+
+  digitalWrite(_cs, LOW);                        //set CS low to enable SPI interface for MAX31855
+
+  for (uint8_t i = 0; i < 4; i++)                //read 32-bits via USI, in order MSB->LSB (D31..D0 bit)
+  {
+    rawData = (rawData << 8) | transfer();
+  }
+
+  digitalWrite(_cs, HIGH);                       //disables SPI interface for MAX31855, but it will initiate measurement/conversion
+
+  return rawData;
+}
+
+#endif
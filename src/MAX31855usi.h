@@ -0,0 +1,78 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for 14-bit MAX31855 K-Thermocouple to Digital Converter
+   with 12-bit Cold Junction Compensation conneted to ATtiny USI (Universal Serial Interface)
+   in three-wire/SPI mode with maximum sampling rate ~9..10Hz.
+
+   - USI shifts bits in hardware, cpu only strobes the clock, so the frame takes
+     ~64..128 cpu cycles & interrupts are never disabled
+   - MAX31855 maximum power supply voltage is 3.6v
+   - K-type thermocouples have an absolute accuracy of around ±2°C..±6°C.
+   - Measurement tempereture range -200°C..+700°C ±2°C or -270°C..+1372°C ±6°C
+     with 0.25°C resolution/increment.
+   - Cold junction compensation range -40°C..+125° ±3°C with 0.062°C resolution/increment.
+     Optimal performance of cold junction compensation happends when the thermocouple cold junction
+     & the MAX31855 are at the same temperature. Avoid placing heat-generating devices or components
+     near the converter because this may produce an errors.
+   - It is strongly recommended to add a 10nF/0.01mF ceramic surface-mount capacitor, placed across
+     the T+ and T- pins, to filter noise on the thermocouple lines.
+     
+   written by : enjoyneering79
+   sourse code: https://github.com/enjoyneering/MAX31855
+
+   This sensor uses USI to communicate, specials pins are required to interface
+   Board:                                     DI/SO       DO/x        USCK/SCK     Level
+   ATtiny85, ATtiny45, ATtiny25.............  PB0         PB1         PB2          3v/5v
+   ATtiny84, ATtiny44, ATtiny24.............  PA6         PA5         PA4          3v/5v
+   ATtiny2313, ATtiny4313...................  PB5         PB6         PB7          3v/5v
+
+                                              *DO is not used & stays free
+
+   Frameworks & Libraries:
+   ATtiny  Core          - https://github.com/SpenceKonde/ATTinyCore
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details  - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef MAX31855usi_h
+#define MAX31855usi_h
+
+#define MAX31855_SOFT_SPI //disable upload hw driver spi.h
+
+#include <MAX31855.h>
+
+#if defined(__AVR_ATtiny25__) || defined(__AVR_ATtiny45__) || defined(__AVR_ATtiny85__)
+#define MAX31855_USI_DDR  DDRB
+#define MAX31855_USI_DI   PB0
+#define MAX31855_USI_USCK PB2
+#elif defined(__AVR_ATtiny24__) || defined(__AVR_ATtiny44__) || defined(__AVR_ATtiny84__)
+#define MAX31855_USI_DDR  DDRA
+#define MAX31855_USI_DI   PA6
+#define MAX31855_USI_USCK PA4
+#elif defined(__AVR_ATtiny2313__) || defined(__AVR_ATtiny4313__)
+#define MAX31855_USI_DDR  DDRB
+#define MAX31855_USI_DI   PB5
+#define MAX31855_USI_USCK PB7
+#endif
+
+#if defined(MAX31855_USI_DDR)                             //compile only for mcu with USI
+
+class MAX31855usi : public MAX31855
+{
+  public:
+   MAX31855usi(uint8_t cs);
+
+   void     beginNoWait(void);
+ 
+  private:
+   uint8_t  transfer(void);
+
+  protected:
+   int32_t  readFrame(void);
+};
+
+#endif
+
+#endif